@@ -8,169 +8,175 @@
 #include "analyzeWeather.h"
 #include "statistics.h"
 
-analyzeWeather::analyzeWeather(const Vector<WeatherRecord>& records) : weatherData(records) {
+analyzeWeather::analyzeWeather(const WeatherTable& records) : weatherData(records) {
     initializeDataStructures();
 }
 
 void analyzeWeather::initializeDataStructures() {
-    // Populate Map and BST with data for efficient access
-    for (int i = 0; i < weatherData.size(); i++) {
-        const WeatherRecord& record = weatherData[i];
-        int year = record.getDate().GetYear();
-        int month = record.getDate().GetMonth();
-
-        // Add year to BST (BST handles duplicates by not inserting)
-        availableYears.insertElement(year);
+    const float* windColumn = weatherData.windSpeeds();
+    const float* tempColumn = weatherData.temperatures();
+    const float* solarColumn = weatherData.solarRadiation();
+    int n = weatherData.size();
+
+    // Pass 1: count the records of each month and add them to its moment sums.
+    // Records arrive grouped by month, so the Map is only searched when the month
+    // key changes. Nothing here allocates per record: keys are ints and the Map
+    // and months only grow when a new month appears
+    Vector<int> months;  // Every month key once, in order of first appearance
+    MonthRange* range = nullptr;  // Month of the previous record, nullptr before the first
+    int rangeKey = 0;
+
+    for (int i = 0; i < n; i++) {
+        Timestamp when = weatherData.getTimestamp(i);
+        int key = createMonthYearKey(when.getMonth(), when.getYear());
+
+        // a new key can move the Map's values, so range is looked up again each time.
+        // Any int can be a key, so "no month yet" is range == nullptr, not a key value
+        if (range == nullptr || key != rangeKey) {
+            range = &monthIndex[key];
+            rangeKey = key;
+
+            if (range->count == 0) {
+                // First record of this month: remember it and add the year to
+                // the BST (BST handles duplicates by not inserting)
+                months.push_back(key);
+                availableYears.insertElement(when.getYear());
+            }
+        }
+        range->count++;
+        range->moments.add(windColumn[i], tempColumn[i], solarColumn[i]);
+    }
 
-        // Add record to Map by month/year key
-        std::string key = createMonthYearKey(month, year);
+    // Prefix sums: each month's slice starts where the previous one ends.
+    // count restarts at 0 and serves as the fill position of pass 2
+    int offset = 0;
+    for (int m = 0; m < months.size(); m++) {
+        MonthRange* month = monthIndex.find(months[m]);
+        month->first = offset;
+        offset += month->count;
+        month->count = 0;
+    }
 
-        // For simplified Map implementation, we'll use the original filtering approach
-        // In a full implementation, we'd add records to Map here
+    // Pass 2: scatter the wind and temperature columns into month order, keeping file order.
+    // No new keys are added from here on, so range stays valid between lookups
+    monthWind.reserve(n);
+    monthTemp.reserve(n);
+    for (int i = 0; i < n; i++) {
+        monthWind.push_back(0.0f);
+        monthTemp.push_back(0.0f);
+    }
+    range = nullptr;
+    for (int i = 0; i < n; i++) {
+        Timestamp when = weatherData.getTimestamp(i);
+        int key = createMonthYearKey(when.getMonth(), when.getYear());
+
+        if (range == nullptr || key != rangeKey) {
+            range = monthIndex.find(key);
+            rangeKey = key;
+        }
+        int slot = range->first + range->count;
+        monthWind[slot] = MonthMoments::convertMpsToKmh(windColumn[i]);
+        monthTemp[slot] = tempColumn[i];
+        range->count++;
     }
 }
 
-std::string analyzeWeather::createMonthYearKey(int month, int year) {
-    // Create key in format "MM/YYYY" (e.g., "01/2010")
-    std::string monthStr = (month < 10) ? "0" + std::to_string(month) : std::to_string(month);
-    return monthStr + "/" + std::to_string(year);
+int analyzeWeather::createMonthYearKey(int month, int year) {
+    // Months since year 0, e.g. 01/2010 is 24120; ordered like the dates
+    return year * 12 + month - 1;
 }
 
 bool analyzeWeather::CalculateWindSpeedStats(int month, int year, float& meanSpeed, float& stdev, float& mad) {
-    Vector<WeatherRecord> filteredRecords;
-    filterRecordsByMonth(month, year, filteredRecords);
-
-    if (filteredRecords.size() == 0) {
+    const MonthRange* range = findMonth(month, year);
+    if (range == nullptr) {
         return false;
     }
 
-    Vector<float> windSpeeds;
-    extractWeatherParameter(filteredRecords, "wind", windSpeeds, true);
-
-    meanSpeed = statistics::calculateMean(windSpeeds);
-    stdev = statistics::calculateStandardDeviation(windSpeeds, meanSpeed);
-    mad = statistics::calculateMAD(windSpeeds, meanSpeed);
+    // MAD needs every value, so take mean and stdev from the same two passes
+    // over the month's contiguous slice of the km/h column
+    statistics::DescriptiveStats stats;
+    statistics::calculateDescriptiveStats(monthWind.begin() + range->first, range->count, stats);
+    meanSpeed = stats.mean;
+    stdev = stats.stdev;
+    mad = stats.mad;
 
     return true;
 }
 
 bool analyzeWeather::calculateTemperatureStats(int month, int year, float& meanTemp, float& stdev, float& mad) {
-    Vector<WeatherRecord> filteredRecords;
-    filterRecordsByMonth(month, year, filteredRecords);
-
-    if (filteredRecords.size() == 0) {
+    const MonthRange* range = findMonth(month, year);
+    if (range == nullptr) {
         return false;
     }
 
-    Vector<float> temperatures;
-    extractWeatherParameter(filteredRecords, "temp", temperatures, false);
-
-    meanTemp = statistics::calculateMean(temperatures);
-    stdev = statistics::calculateStandardDeviation(temperatures, meanTemp);
-    mad = statistics::calculateMAD(temperatures, meanTemp);
+    // MAD needs every value, so take mean and stdev from the same two passes
+    statistics::DescriptiveStats stats;
+    statistics::calculateDescriptiveStats(monthTemp.begin() + range->first, range->count, stats);
+    meanTemp = stats.mean;
+    stdev = stats.stdev;
+    mad = stats.mad;
 
     return true;
 }
 
 bool analyzeWeather::calculateSolarRadiation(int month, int year, float& totalRadiation) {
-    Vector<WeatherRecord> filteredRecords;
-    filterRecordsByMonth(month, year, filteredRecords);
-
-    if (filteredRecords.size() == 0) {
+    const MonthRange* range = findMonth(month, year);
+    if (range == nullptr) {
         return false;
     }
 
-    Vector<float> solarValues;
-    extractWeatherParameter(filteredRecords, "solar", solarValues, true);
-
-    totalRadiation = statistics::calculateSum(solarValues);
+    totalRadiation = static_cast<float>(range->moments.solar.sum);
     return true;
 }
 
-bool analyzeWeather::calculatesPCC(int month, int year, const std::string& dataType1,
-                                  const std::string& dataType2, float& correlation) {
-    Vector<WeatherRecord> filteredRecords;
-    filterRecordsByMonth(month, year, filteredRecords);
-
-    if (filteredRecords.size() < 2) {
+bool analyzeWeather::calculatesPCC(int month, int year, WeatherParameter parameter1,
+                                  WeatherParameter parameter2, float& correlation) {
+    const MonthRange* range = findMonth(month, year);
+    if (range == nullptr || range->count < 2) {
         return false; // Need at least 2 points for correlation
     }
 
-    Vector<float> values1, values2;
-    extractWeatherParameter(filteredRecords, dataType1, values1, true);
-    extractWeatherParameter(filteredRecords, dataType2, values2, true);
-
-    correlation = statistics::calculatesPCC(values1, values2);
+    correlation = statistics::calculatesPCC(range->moments.select(parameter1), range->moments.select(parameter2),
+                                            range->moments.sumProducts(parameter1, parameter2));
     return true;
 }
 
-void analyzeWeather::extractWeatherParameter(const Vector<WeatherRecord>& records,
-                                           const std::string& dataType,
-                                           Vector<float>& values,
-                                           bool convertUnits) {
-    for (int i = 0; i < records.size(); i++) {
-        if (dataType == "wind") {
-            float windSpeed = records[i].getWindSpeed();
-            if (convertUnits) {
-                windSpeed = convertMpsToKmh(windSpeed);
-            }
-            values.push_back(windSpeed);
-        } else if (dataType == "temp") {
-            values.push_back(records[i].getTemperature());
-        } else if (dataType == "solar") {
-            float solarRad = records[i].getSolarRadiation();
-            if (convertUnits) {
-                solarRad = convertWm2ToKwhM2(solarRad);
-            }
-            values.push_back(solarRad);
-        }
-    }
+bool analyzeWeather::hasDataForMonth(int month, int year) {
+    return findMonth(month, year) != nullptr;
 }
 
-bool analyzeWeather::hasDataForMonth(int month, int year) {
-    for (int i = 0; i < weatherData.size(); i++) {
-        if (weatherData[i].getDate().GetMonth() == month && weatherData[i].getDate().GetYear() == year) {
-            return true;
+void analyzeWeather::calculateYearStats(int year, Vector<MonthStats>& stats) {
+    stats.clear();
+    for (int month = 1; month <= 12; month++) {
+        const MonthRange* range = findMonth(month, year);
+        if (range != nullptr) {
+            MonthStats monthStats;
+            monthStats.year = year;
+            monthStats.month = month;
+            calculateMonthStats(*range, monthStats);
+            stats.push_back(monthStats);
         }
     }
-    return false;
 }
 
 void analyzeWeather::getAvailableYears(Vector<int>& years) {
-    // For simplified implementation, extract years directly
-    // In full implementation, we'd traverse the BST
+    // The BST already holds each year once, an in-order walk lists them ascending
     Vector<int> foundYears;
-
-    for (int i = 0; i < weatherData.size(); i++) {
-        int year = weatherData[i].getDate().GetYear();
-
-        bool alreadyExists = false;
-        for (int j = 0; j < foundYears.size(); j++) {
-            if (foundYears[j] == year) {
-                alreadyExists = true;
-                break;
-            }
-        }
-
-        if (!alreadyExists) {
-            foundYears.push_back(year);
-        }
-    }
-    years = foundYears;
-}
-
-void analyzeWeather::filterRecordsByMonth(int month, int year, Vector<WeatherRecord>& filteredRecords) {
-    for (int i = 0; i < weatherData.size(); i++) {
-        if (weatherData[i].getDate().GetMonth() == month && weatherData[i].getDate().GetYear() == year) {
-            filteredRecords.push_back(weatherData[i]);
-        }
-    }
+    availableYears.inOrderTraversal([&foundYears](int& year) {
+        foundYears.push_back(year);
+    });
+    years = std::move(foundYears);
 }
 
-float analyzeWeather::convertMpsToKmh(float mps) {
-    return mps * 3.6f;
+const analyzeWeather::MonthRange* analyzeWeather::findMonth(int month, int year) {
+    return monthIndex.find(createMonthYearKey(month, year));
 }
 
-float analyzeWeather::convertWm2ToKwhM2(float wPerM2) {
-    return wPerM2 * (1.0f / 6.0f) / 1000.0f;
-}
+void analyzeWeather::calculateMonthStats(const MonthRange& range, MonthStats& stats) {
+    // The sums give mean and stdev, so each slice is only read for MAD
+    statistics::calculateDescriptiveStats(monthWind.begin() + range.first, range.count,
+                                          range.moments.wind, stats.wind);
+    statistics::calculateDescriptiveStats(monthTemp.begin() + range.first, range.count,
+                                          range.moments.temp, stats.temp);
+    stats.solarTotal = static_cast<float>(range.moments.solar.sum);
+}
\ No newline at end of file
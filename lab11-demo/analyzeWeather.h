@@ -2,9 +2,11 @@
 #define ANALYZE_WEATHER_H
 
 #include "vector.h"
-#include "weatherRecord.h"
+#include "weatherTable.h"
 #include "map.h"
 #include "bst.h"
+#include "statistics.h"
+#include "monthMoments.h"
 #include <string>
 
 /**
@@ -23,9 +25,9 @@ public:
 
     /**
      * @brief Constructor
-     * @param records Reference to vector containing weather data
+     * @param records Reference to the columnar table containing weather data
      */
-    analyzeWeather(const Vector<WeatherRecord>& records);
+    analyzeWeather(const WeatherTable& records);
 
     /**
      * @brief Calculates wind speed statistics for a specific month and year
@@ -62,13 +64,13 @@ public:
      * @brief Calculates Sample Pearson Correlation Coefficient between two weather parameters
      * @param month Month to analyze (1-12)
      * @param year Year to analyze
-     * @param dataType1 First parameter type: "wind", "temp", or "solar"
-     * @param dataType2 Second parameter type: "wind", "temp", or "solar"
+     * @param parameter1 First parameter
+     * @param parameter2 Second parameter
      * @param correlation Output parameter for correlation coefficient (-1 to 1)
      * @return true if data found and calculated, false if no data available
      */
-    bool calculatesPCC(int month, int year, const std::string& dataType1,
-                       const std::string& dataType2, float& correlation);
+    bool calculatesPCC(int month, int year, WeatherParameter parameter1,
+                       WeatherParameter parameter2, float& correlation);
 
     /**
      * @brief Checks if data exists for a specific month and year
@@ -78,63 +80,76 @@ public:
      */
     bool hasDataForMonth(int month, int year);
 
+    /**
+     * @brief Calculates every export statistic of each month of a year in one pass
+     *
+     * The queries above each look the month up and read its values again, 48
+     * calls for a year of exports. Here each month is looked up once; mean,
+     * standard deviation and total come from its moment sums and the wind and
+     * temperature values are read once, for MAD.
+     *
+     * @param year Year to analyze
+     * @param stats Output, one entry per month with data, in month order (empty if none)
+     */
+    void calculateYearStats(int year, Vector<MonthStats>& stats);
+
     /**
      * @brief Gets all available years in the dataset using BST for efficient storage
-     * @param years Vector to store the unique years found
+     * @param years Vector to store the unique years found, in ascending order
      */
     void getAvailableYears(Vector<int>& years);
 
 private:
-    const Vector<WeatherRecord>& weatherData;  // Reference to weather data
-    Map<std::string, Vector<WeatherRecord>> monthlyDataMap;  // Custom Map for fast lookup
-    BinarySearchTree<int> availableYears;  // BST for year organization
+    /**
+     * @brief Records of one month: a slice of the month ordered columns and its moment sums
+     */
+    struct MonthRange {
+        int first = 0;  // Position of the month's first value in monthWind and monthTemp
+        int count = 0;  // Number of records in the month
+        MonthMoments moments;  // Built with the index, answers total and sPCC without the records
+    };
+
+    const WeatherTable& weatherData;  // Reference to weather data
+    Vector<float> monthWind;  // Wind speeds in km/h grouped by month, file order kept within a month
+    Vector<float> monthTemp;  // Temperatures in C, same order as monthWind
+    Map<int, MonthRange> monthIndex;  // Custom Map (flat, integral keys) of month key to that month's slice of the columns
+    BalancedSearchTree<int> availableYears;  // Balanced BST for year organization (years arrive in order)
 
     /**
      * @brief Initializes the Map and BST with weather data for efficient access
+     *
+     * A counting sort over the months: one pass over the table columns counts
+     * the records of each month and adds them to its moment sums, prefix sums
+     * give each month its slice, a second pass scatters the wind and
+     * temperature columns into place. O(records) with no allocation per
+     * record; the Map is only searched when the month changes from one record
+     * to the next. Afterwards every month is one contiguous span of floats
+     * that the statistics kernels read directly.
      */
     void initializeDataStructures();
 
     /**
-     * @brief Creates a key string for month/year combination
+     * @brief Creates the Map key of a month/year combination
      * @param month Month (1-12)
      * @param year Year
-     * @return Key string in format "MM/YYYY"
-     */
-    std::string createMonthYearKey(int month, int year);
-
-    /**
-     * @brief Filters records by month and year
-     * @param month Month to filter by (1-12)
-     * @param year Year to filter by
-     * @param filteredRecords Output vector for matching records
-     */
-    void filterRecordsByMonth(int month, int year, Vector<WeatherRecord>& filteredRecords);
-
-    /**
-     * @brief Extracts specific weather parameter from records into float vector
-     * @param records Input weather records
-     * @param dataType Parameter type: "wind", "temp", or "solar"
-     * @param values Output vector for parameter values
-     * @param convertUnits Whether to convert units (wind: m/s to km/h, solar: W/m to kWh/m)
+     * @return year * 12 + month - 1, consecutive months have consecutive keys
      */
-    void extractWeatherParameter(const Vector<WeatherRecord>& records,
-                                const std::string& dataType,
-                                Vector<float>& values,
-                                bool convertUnits = true);
+    static int createMonthYearKey(int month, int year);
 
     /**
-     * @brief Converts wind speed from m/s to km/h
-     * @param mps Wind speed in meters per second
-     * @return Wind speed in kilometers per hour
+     * @brief Finds the slice of records for a month and year
+     * @param month Month to look up (1-12)
+     * @param year Year to look up
+     * @return The month's range in the month ordered columns, nullptr if there are no records
      */
-    float convertMpsToKmh(float mps);
+    const MonthRange* findMonth(int month, int year);
 
     /**
-     * @brief Converts solar radiation from W/m to kWh/m
-     * @param wPerM2 Solar radiation in watts per square meter
-     * @return Solar radiation in kilowatt-hours per square meter
+     * @brief Calculates the export statistics of one month
+     * @param range The month's slice and sums
+     * @param stats Output, month and year are left to the caller
      */
-    float convertWm2ToKwhM2(float wPerM2);
+    void calculateMonthStats(const MonthRange& range, MonthStats& stats);
 };
 
 #endif // ANALYZE_WEATHER_H
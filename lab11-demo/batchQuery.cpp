@@ -0,0 +1,189 @@
+/**
+ * @file batchQuery.cpp
+ * @brief Implementation of the non-interactive queries
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ */
+
+#include "batchQuery.h"
+#include "weatherExport.h"
+#include <iomanip>
+#include <sstream>
+
+BatchQuery::BatchQuery(analyzeWeather& analyzer) : analyzer(analyzer) {}
+
+int BatchQuery::run(std::istream& in, std::ostream& out) {
+    int errors = 0;
+    int lineNumber = 0;
+    std::string line;
+    Vector<std::string> fields;
+
+    while (std::getline(in, line)) {
+        lineNumber++;
+        splitFields(line, fields);
+        if (fields.size() == 0 || fields[0][0] == '#') {
+            continue;
+        }
+
+        std::string error;
+        if (!runQuery(fields, out, error)) {
+            out << "error," << lineNumber << "," << error << std::endl;
+            errors++;
+        }
+    }
+    return errors;
+}
+
+bool BatchQuery::runQuery(const Vector<std::string>& fields, std::ostream& out, std::string& error) {
+    const std::string& command = fields[0];
+    if (command == "wind" || command == "temp" || command == "solar") {
+        return runStats(fields, out, error);
+    } else if (command == "pcc") {
+        return runCorrelation(fields, out, error);
+    } else if (command == "export") {
+        return runExport(fields, out, error);
+    } else if (command == "years") {
+        return runYears(fields, out, error);
+    }
+
+    error = "unknown query " + command;
+    return false;
+}
+
+bool BatchQuery::runStats(const Vector<std::string>& fields, std::ostream& out, std::string& error) {
+    if (fields.size() != 3) {
+        error = "expected " + fields[0] + " MONTH YEAR";
+        return false;
+    }
+
+    int month, year;
+    if (!parseMonthYear(fields, 1, month, year, error)) {
+        return false;
+    }
+
+    float mean, stdev, mad, total;
+    bool found;
+    if (fields[0] == "wind") {
+        found = analyzer.CalculateWindSpeedStats(month, year, mean, stdev, mad);
+    } else if (fields[0] == "temp") {
+        found = analyzer.calculateTemperatureStats(month, year, mean, stdev, mad);
+    } else {
+        found = analyzer.calculateSolarRadiation(month, year, total);
+    }
+
+    echoQuery(fields, out);
+    if (!found) {
+        out << ",nodata" << std::endl;
+    } else if (fields[0] == "solar") {
+        out << ",ok," << std::fixed << std::setprecision(2) << total << std::endl;
+    } else {
+        out << ",ok," << std::fixed << std::setprecision(2) << mean << "," << stdev << "," << mad << std::endl;
+    }
+    return true;
+}
+
+bool BatchQuery::runCorrelation(const Vector<std::string>& fields, std::ostream& out, std::string& error) {
+    if (fields.size() != 5) {
+        error = "expected pcc PARAM1 PARAM2 MONTH YEAR";
+        return false;
+    }
+    WeatherParameter parameters[2];
+    for (int i = 0; i < 2; i++) {
+        if (!parseWeatherParameter(fields[i + 1], parameters[i])) {
+            error = "unknown parameter " + fields[i + 1];
+            return false;
+        }
+    }
+
+    int month, year;
+    if (!parseMonthYear(fields, 3, month, year, error)) {
+        return false;
+    }
+
+    float correlation;
+    echoQuery(fields, out);
+    if (analyzer.calculatesPCC(month, year, parameters[0], parameters[1], correlation)) {
+        out << ",ok," << std::fixed << std::setprecision(4) << correlation << std::endl;
+    } else {
+        out << ",nodata" << std::endl;
+    }
+    return true;
+}
+
+bool BatchQuery::runExport(const Vector<std::string>& fields, std::ostream& out, std::string& error) {
+    if (fields.size() != 2 && fields.size() != 3) {
+        error = "expected export YEAR [FILE]";
+        return false;
+    }
+
+    int year;
+    if (!parseInt(fields[1], year)) {
+        error = "year is not a number";
+        return false;
+    }
+    std::string filename = (fields.size() == 3) ? fields[2] : weatherExport::exportFilename;
+
+    // The file is written even for a year without data, as in the menu
+    bool opened = (year == 0) ? weatherExport::exportAllYears(filename, analyzer)
+                              : weatherExport::exportYear(filename, year, analyzer);
+    if (!opened) {
+        error = "cannot open " + filename + " for writing";
+        return false;
+    }
+
+    out << "export," << year << ",ok," << filename << std::endl;
+    return true;
+}
+
+bool BatchQuery::runYears(const Vector<std::string>& fields, std::ostream& out, std::string& error) {
+    if (fields.size() != 1) {
+        error = "expected years";
+        return false;
+    }
+
+    Vector<int> years;
+    analyzer.getAvailableYears(years);
+    out << "years,ok";
+    for (int i = 0; i < years.size(); i++) {
+        out << "," << years[i];
+    }
+    out << std::endl;
+    return true;
+}
+
+void BatchQuery::splitFields(const std::string& line, Vector<std::string>& fields) {
+    fields.clear();
+    std::istringstream stream(line);
+    std::string field;
+    while (stream >> field) {
+        fields.push_back(field);
+    }
+}
+
+bool BatchQuery::parseInt(const std::string& field, int& value) {
+    std::istringstream stream(field);
+    char extra;
+    return (stream >> value) && !(stream >> extra);
+}
+
+bool BatchQuery::parseMonthYear(const Vector<std::string>& fields, int first, int& month, int& year,
+                                std::string& error) {
+    if (!parseInt(fields[first], month) || !parseInt(fields[first + 1], year)) {
+        error = "month and year must be numbers";
+        return false;
+    }
+    if (month < 1 || month > 12) {
+        error = "month must be 1-12";
+        return false;
+    }
+    return true;
+}
+
+void BatchQuery::echoQuery(const Vector<std::string>& fields, std::ostream& out) {
+    for (int i = 0; i < fields.size(); i++) {
+        if (i > 0) {
+            out << ",";
+        }
+        out << fields[i];
+    }
+}
@@ -0,0 +1,137 @@
+#ifndef BATCH_QUERY_H
+#define BATCH_QUERY_H
+
+#include "analyzeWeather.h"
+#include "vector.h"
+#include <istream>
+#include <ostream>
+#include <string>
+
+/**
+ * @file batchQuery.h
+ * @brief Non-interactive queries against loaded weather data
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ */
+
+/**
+ * @class BatchQuery
+ * @brief Answers a list of queries, one per line, with one CSV line each
+ *
+ * The scripted counterpart of Menu: the data is loaded and indexed once, then
+ * every query runs against the same analyzeWeather. Queries (fields separated
+ * by spaces, blank lines and lines starting with # are skipped):
+ *
+ *     wind MONTH YEAR                 -> wind,MONTH,YEAR,ok,mean,stdev,mad      (km/h)
+ *     temp MONTH YEAR                 -> temp,MONTH,YEAR,ok,mean,stdev,mad      (degrees C)
+ *     solar MONTH YEAR                -> solar,MONTH,YEAR,ok,total              (kWh/m2)
+ *     pcc PARAM1 PARAM2 MONTH YEAR    -> pcc,PARAM1,PARAM2,MONTH,YEAR,ok,sPCC
+ *     export YEAR [FILE]              -> export,YEAR,ok,FILE
+ *     years                           -> years,ok,YEAR,YEAR,...
+ *
+ * PARAM is wind, temp or solar. export writes the menu option 4 file,
+ * WindTempSolar.csv unless FILE is given, and YEAR 0 exports every year into
+ * it. A query without data answers with the query followed by "nodata"; a
+ * query that cannot be read answers "error,LINE,reason". Statistics have two
+ * decimals and sPCC four, as in the menu.
+ */
+class BatchQuery {
+public:
+    /**
+     * @brief Constructor
+     * @param analyzer Analyzer of the loaded data, used by every query
+     */
+    explicit BatchQuery(analyzeWeather& analyzer);
+
+    /**
+     * @brief Answers every query of a stream
+     * @param in Queries, one per line
+     * @param out Stream the answers are written to, one line per query
+     * @return Number of queries answered with error
+     */
+    int run(std::istream& in, std::ostream& out);
+
+    /**
+     * @brief Reads a whole field as an integer, also used for the --stream YEAR argument
+     * @param field Field text
+     * @param value Output for the value
+     * @return false if the field is not an integer, e.g. "abc" or "20x5"
+     */
+    static bool parseInt(const std::string& field, int& value);
+
+private:
+    analyzeWeather& analyzer;  // Reference to the analyzer of the loaded data
+
+    /**
+     * @brief Answers one query
+     * @param fields The query split at spaces, at least one field
+     * @param out Stream the answer is written to
+     * @param error Output for the reason when the query cannot be read
+     * @return false if the query cannot be read (nothing written)
+     */
+    bool runQuery(const Vector<std::string>& fields, std::ostream& out, std::string& error);
+
+    /**
+     * @brief Answers wind, temp or solar MONTH YEAR
+     * @param fields The query
+     * @param out Stream the answer is written to
+     * @param error Output for the reason when the query cannot be read
+     * @return false if the query cannot be read
+     */
+    bool runStats(const Vector<std::string>& fields, std::ostream& out, std::string& error);
+
+    /**
+     * @brief Answers pcc PARAM1 PARAM2 MONTH YEAR
+     * @param fields The query
+     * @param out Stream the answer is written to
+     * @param error Output for the reason when the query cannot be read
+     * @return false if the query cannot be read
+     */
+    bool runCorrelation(const Vector<std::string>& fields, std::ostream& out, std::string& error);
+
+    /**
+     * @brief Answers export YEAR [FILE]
+     * @param fields The query
+     * @param out Stream the answer is written to
+     * @param error Output for the reason when the query cannot be read
+     * @return false if the query cannot be read
+     */
+    bool runExport(const Vector<std::string>& fields, std::ostream& out, std::string& error);
+
+    /**
+     * @brief Answers years
+     * @param fields The query
+     * @param out Stream the answer is written to
+     * @param error Output for the reason when the query cannot be read
+     * @return false if the query cannot be read
+     */
+    bool runYears(const Vector<std::string>& fields, std::ostream& out, std::string& error);
+
+    /**
+     * @brief Splits a line at whitespace
+     * @param line Line to split
+     * @param fields Output for the fields, empty for a blank line
+     */
+    static void splitFields(const std::string& line, Vector<std::string>& fields);
+
+    /**
+     * @brief Reads the MONTH YEAR fields that end a query
+     * @param fields The query
+     * @param first Position of MONTH
+     * @param month Output for the month (1-12)
+     * @param year Output for the year
+     * @param error Output for the reason when they cannot be read
+     * @return false if either is not a number or the month is out of range
+     */
+    static bool parseMonthYear(const Vector<std::string>& fields, int first, int& month, int& year,
+                               std::string& error);
+
+    /**
+     * @brief Writes the query fields back, comma separated, as the start of its answer
+     * @param fields The query
+     * @param out Stream to write to
+     */
+    static void echoQuery(const Vector<std::string>& fields, std::ostream& out);
+};
+
+#endif // BATCH_QUERY_H
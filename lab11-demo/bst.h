@@ -1,7 +1,11 @@
 #ifndef BST_H
 #define BST_H
 
+#include "vector.h"
 #include <iostream>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 /**
  * @file bst.h
@@ -23,9 +27,157 @@ struct nodeType
     T data;                    ///< Data stored in the node
     nodeType<T>* left;         ///< Pointer to left child
     nodeType<T>* right;        ///< Pointer to right child
+    int height;                ///< Height of the subtree rooted here (only kept up to date when balanced)
 
     /// Constructor
-    nodeType(const T& value) : data(value), left(nullptr), right(nullptr) {}
+    nodeType(const T& value) : data(value), left(nullptr), right(nullptr), height(1) {}
+
+    /// Constructor taking over a value built only to be stored
+    nodeType(T&& value) : data(std::move(value)), left(nullptr), right(nullptr), height(1) {}
+};
+
+/**
+ * @brief Default node allocator, one new and one delete per node
+ */
+template <class T>
+class HeapNodeAllocator
+{
+public:
+    /// Allocates and constructs a node holding value
+    nodeType<T>* create(const T& value)
+    {
+        return new nodeType<T>(value);
+    }
+
+    /// Allocates a node and moves value into it
+    nodeType<T>* create(T&& value)
+    {
+        return new nodeType<T>(std::move(value));
+    }
+
+    /// Deletes every node of the tree at root
+    void destroyAll(nodeType<T>* root)
+    {
+        // rotate left children up until the node has none, then delete it and move right;
+        // no stack at all, every node is rotated at most once
+        nodeType<T>* node = root;
+        while (node != nullptr)
+        {
+            if (node->left != nullptr)
+            {
+                nodeType<T>* leftChild = node->left;
+                node->left = leftChild->right;
+                leftChild->right = node;
+                node = leftChild;
+            }
+            else
+            {
+                nodeType<T>* next = node->right;
+                delete node;
+                node = next;
+            }
+        }
+    }
+};
+
+/**
+ * @brief Slab allocator giving the nodes of one tree contiguous storage
+ *
+ * Nodes are carved out of blocks that double in size (up to maxBlockNodes),
+ * so neighbouring inserts sit next to each other in memory and a tree of
+ * n nodes needs about n / maxBlockNodes allocations instead of n. The tree
+ * never removes single nodes, so destroyAll just releases the blocks:
+ * O(blocks) when T is trivially destructible, one linear sweep over the
+ * blocks to run the destructors otherwise.
+ *
+ * Each tree owns its pool, so it cannot be copied; copying a tree gives
+ * the copy a fresh pool.
+ */
+template <class T>
+class PoolNodeAllocator
+{
+public:
+    PoolNodeAllocator() : blocks(nullptr), nextNodes(firstBlockNodes) {}
+    ~PoolNodeAllocator() { destroyAll(nullptr); }
+
+    PoolNodeAllocator(const PoolNodeAllocator&) = delete;
+    PoolNodeAllocator& operator=(const PoolNodeAllocator&) = delete;
+
+    /// Constructs a node holding value in the current block
+    nodeType<T>* create(const T& value)
+    {
+        return emplace(value);
+    }
+
+    /// Constructs a node in the current block and moves value into it
+    nodeType<T>* create(T&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    /// Destroys every node handed out so far, root is not needed
+    void destroyAll(nodeType<T>* root)
+    {
+        (void)root;
+        while (blocks != nullptr)
+        {
+            Block* next = blocks->next;
+            if (!std::is_trivially_destructible<T>::value)
+            {
+                for (int i = 0; i < blocks->used; i++)
+                {
+                    blocks->nodes[i].~nodeType<T>();
+                }
+            }
+            ::operator delete(blocks->nodes);
+            delete blocks;
+            blocks = next;
+        }
+        nextNodes = firstBlockNodes;
+    }
+
+private:
+    static const int firstBlockNodes = 64;      ///< Nodes in the first block
+    static const int maxBlockNodes = 65536;     ///< Largest block, limits the waste of the last one
+
+    /// One slab of node storage, newest block first
+    struct Block
+    {
+        nodeType<T>* nodes;     ///< Raw storage for capacity nodes
+        int used;               ///< Nodes constructed so far
+        int capacity;           ///< Nodes the block can hold
+        Block* next;            ///< Previous (older) block
+    };
+
+    Block* blocks;              ///< Newest block, the only one with free space
+    int nextNodes;              ///< Capacity of the next block
+
+    /// Constructs a node from value (copied or moved) in the current block
+    template <class Value>
+    nodeType<T>* emplace(Value&& value)
+    {
+        if (blocks == nullptr || blocks->used == blocks->capacity)
+        {
+            addBlock();
+        }
+        nodeType<T>* node = new (blocks->nodes + blocks->used) nodeType<T>(std::forward<Value>(value));
+        blocks->used++;
+        return node;
+    }
+
+    void addBlock()
+    {
+        Block* block = new Block;
+        block->nodes = static_cast<nodeType<T>*>(::operator new(sizeof(nodeType<T>) * nextNodes));
+        block->used = 0;
+        block->capacity = nextNodes;
+        block->next = blocks;
+        blocks = block;
+        if (nextNodes < maxBlockNodes)
+        {
+            nextNodes *= 2;
+        }
+    }
 };
 
 /**
@@ -38,7 +190,7 @@ struct nodeType
  *
  * This is MINIMAL - only essential operations included:
  * - Insert, Search, Destroy (core BST operations)
- * - Traversals with function pointers (for flexibility)
+ * - Traversals with function pointers or any callable (for flexibility)
  * - Constructor/Destructor (memory management)
  *
  * Specifically EXCLUDED from minimal design:
@@ -46,8 +198,24 @@ struct nodeType
  * - height() - not core BST functionality
  * - nodeCount() - not essential for BST behavior
  * - complex deletion operations - not required for minimal implementation
+ *
+ * Balanced mode (Balanced = true, or the BalancedSearchTree alias):
+ * The tree is kept AVL balanced on every insert, so the height stays below
+ * 1.44 log2(n) even when values arrive already sorted, as dates from the CSV
+ * files do. The interface is unchanged; unbalanced is the default so existing
+ * users keep the plain BST behaviour.
+ *
+ * None of the algorithms recurse. Insert and search walk down with a loop,
+ * destroy flattens the tree with rotations (or drops the node pool), and
+ * copy and the traversals keep their pending nodes in a Vector, so even a
+ * plain tree built from sorted input (a linked list of millions of nodes)
+ * cannot overflow the call stack.
+ *
+ * Node storage comes from NodeAllocator: HeapNodeAllocator (the default)
+ * news every node, PoolNodeAllocator packs them into blocks and frees the
+ * whole tree block by block.
  */
-template <class T>
+template <class T, bool Balanced = false, class NodeAllocator = HeapNodeAllocator<T>>
 class BinarySearchTree
 {
 public:
@@ -59,12 +227,30 @@ public:
     // Constructors and Destructor
     BinarySearchTree();                                          ///< Default constructor
     ~BinarySearchTree();                                         ///< Destructor
-    BinarySearchTree(const BinarySearchTree<T>& other);         ///< Copy constructor
-    BinarySearchTree<T>& operator=(const BinarySearchTree<T>& other); ///< Assignment operator
+    BinarySearchTree(const BinarySearchTree& other);            ///< Copy constructor
+    BinarySearchTree& operator=(const BinarySearchTree& other); ///< Assignment operator
 
     // Core BST operations (MINIMAL set)
     void insertElement(const T& value);                         ///< Insert element into BST
     bool searchElement(const T& value) const;                   ///< Search for element in BST
+
+    // Access to the stored element, for containers such as Map that keep a
+    // payload next to the key. Only parts that take no part in the ordering
+    // may be changed through the returned pointer.
+    T* findElement(const T& value);                             ///< Stored element equal to value, nullptr if none
+    const T* findElement(const T& value) const;                 ///< Stored element equal to value, nullptr if none
+    T* findOrInsert(const T& value, bool* inserted = nullptr);  ///< Stored element equal to value, inserted first if missing (one descent)
+
+    // The same lookups by part of an element, so no whole element has to be
+    // built to search for one. compare(element) is negative when the wanted
+    // element sorts before element, positive when after and 0 when it is the
+    // one; make() returns the element to store and is only called on insert.
+    template <class Compare>
+    T* findElementBy(Compare compare);                          ///< Stored element compare picks, nullptr if none
+    template <class Compare>
+    const T* findElementBy(Compare compare) const;              ///< Stored element compare picks, nullptr if none
+    template <class Compare, class Make>
+    T* findOrInsertBy(Compare compare, Make make, bool* inserted = nullptr); ///< Stored element compare picks, make() inserted first if missing
     void destroyTree();                                          ///< Clear all nodes from BST
 
     // Traversal operations with function pointers
@@ -72,40 +258,81 @@ public:
     void preOrderTraversal(f1Typ f1) const;                    ///< Pre-order traversal with callback
     void postOrderTraversal(f1Typ f1) const;                   ///< Post-order traversal with callback
 
+    // Traversal operations with any callable taking T&, such as a capturing lambda.
+    // The call is inlined into the loop. A visitor returning bool stops the walk
+    // by returning false; the traversal then returns false as well.
+    template <class Visitor>
+    bool inOrderTraversal(Visitor visit) const;                ///< In-order traversal with a visitor
+    template <class Visitor>
+    bool preOrderTraversal(Visitor visit) const;               ///< Pre-order traversal with a visitor
+    template <class Visitor>
+    bool postOrderTraversal(Visitor visit) const;              ///< Post-order traversal with a visitor
+
 private:
     nodeType<T>* root;                                          ///< Root of the BST
-
-    // Private helper methods
-    nodeType<T>* insertRecursive(nodeType<T>* node, const T& value);
-    bool searchRecursive(nodeType<T>* node, const T& value) const;
-    void inOrder(f1Typ f1, nodeType<T>* node) const;
-    void preOrder(f1Typ f1, nodeType<T>* node) const;
-    void postOrder(f1Typ f1, nodeType<T>* node) const;
-    void destroyRecursive(nodeType<T>* node);
-    nodeType<T>* copyTree(nodeType<T>* node);
+    NodeAllocator nodes;                                        ///< Creates and frees the nodes of this tree
+
+    /// Longest insert path kept for rebalancing; an AVL tree this tall would
+    /// need more nodes than fit in memory
+    static const int maxBalancedHeight = 96;
+
+    // Private helper methods (all iterative, the stack depth never depends on the tree height)
+    nodeType<T>* copyTree(const nodeType<T>* node);
+    nodeType<T>* findNode(const T& value) const;
+    nodeType<T>* insertNode(const T& value, bool& inserted);
+    template <class Compare>
+    nodeType<T>* findNodeBy(Compare compare) const;
+    template <class Compare, class Make>
+    nodeType<T>* insertNodeBy(Compare compare, Make make, bool& inserted);
+
+    /// Orders a stored element against value with the element's own operators
+    struct ValueCompare
+    {
+        const T& value;
+        int operator()(const T& data) const { return value < data ? -1 : (value > data ? 1 : 0); }
+    };
+
+    // Calls a visitor, true means keep going (always for visitors returning void)
+    template <class Visitor>
+    static bool visitNode(Visitor& visit, T& data);
+    template <class Visitor>
+    static bool visitNode(Visitor& visit, T& data, std::true_type returnsBool);
+    template <class Visitor>
+    static bool visitNode(Visitor& visit, T& data, std::false_type returnsBool);
+
+    // AVL helpers for the balanced mode
+    static int height(nodeType<T>* node);
+    static void updateHeight(nodeType<T>* node);
+    static nodeType<T>* rotateLeft(nodeType<T>* node);
+    static nodeType<T>* rotateRight(nodeType<T>* node);
+    static nodeType<T>* rebalance(nodeType<T>* node);
 };
 
+/// Binary search tree that stays AVL balanced on insert
+template <class T>
+using BalancedSearchTree = BinarySearchTree<T, true>;
+
 // Template Implementation
 
-template <class T>
-BinarySearchTree<T>::BinarySearchTree() : root(nullptr)
+template <class T, bool Balanced, class NodeAllocator>
+BinarySearchTree<T, Balanced, NodeAllocator>::BinarySearchTree() : root(nullptr), nodes()
 {
 }
 
-template <class T>
-BinarySearchTree<T>::~BinarySearchTree()
+template <class T, bool Balanced, class NodeAllocator>
+BinarySearchTree<T, Balanced, NodeAllocator>::~BinarySearchTree()
 {
     destroyTree();
 }
 
-template <class T>
-BinarySearchTree<T>::BinarySearchTree(const BinarySearchTree<T>& other) : root(nullptr)
+template <class T, bool Balanced, class NodeAllocator>
+BinarySearchTree<T, Balanced, NodeAllocator>::BinarySearchTree(const BinarySearchTree& other) : root(nullptr), nodes()
 {
     root = copyTree(other.root);
 }
 
-template <class T>
-BinarySearchTree<T>& BinarySearchTree<T>::operator=(const BinarySearchTree<T>& other)
+template <class T, bool Balanced, class NodeAllocator>
+BinarySearchTree<T, Balanced, NodeAllocator>& BinarySearchTree<T, Balanced, NodeAllocator>::operator=(const BinarySearchTree& other)
 {
     if (this != &other)
     {
@@ -115,144 +342,399 @@ BinarySearchTree<T>& BinarySearchTree<T>::operator=(const BinarySearchTree<T>& o
     return *this;
 }
 
-template <class T>
-void BinarySearchTree<T>::insertElement(const T& value)
+template <class T, bool Balanced, class NodeAllocator>
+void BinarySearchTree<T, Balanced, NodeAllocator>::insertElement(const T& value)
 {
-    root = insertRecursive(root, value);
+    bool inserted;
+    insertNode(value, inserted);
 }
 
-template <class T>
-nodeType<T>* BinarySearchTree<T>::insertRecursive(nodeType<T>* node, const T& value)
+template <class T, bool Balanced, class NodeAllocator>
+bool BinarySearchTree<T, Balanced, NodeAllocator>::searchElement(const T& value) const
 {
-    if (node == nullptr)
-    {
-        return new nodeType<T>(value);
-    }
+    return findNode(value) != nullptr;
+}
 
-    if (value < node->data)
-    {
-        node->left = insertRecursive(node->left, value);
-    }
-    else if (value > node->data)
+template <class T, bool Balanced, class NodeAllocator>
+T* BinarySearchTree<T, Balanced, NodeAllocator>::findElement(const T& value)
+{
+    nodeType<T>* node = findNode(value);
+    return node == nullptr ? nullptr : &node->data;
+}
+
+template <class T, bool Balanced, class NodeAllocator>
+const T* BinarySearchTree<T, Balanced, NodeAllocator>::findElement(const T& value) const
+{
+    nodeType<T>* node = findNode(value);
+    return node == nullptr ? nullptr : &node->data;
+}
+
+template <class T, bool Balanced, class NodeAllocator>
+T* BinarySearchTree<T, Balanced, NodeAllocator>::findOrInsert(const T& value, bool* inserted)
+{
+    bool wasInserted;
+    nodeType<T>* node = insertNode(value, wasInserted);
+    if (inserted != nullptr)
     {
-        node->right = insertRecursive(node->right, value);
+        *inserted = wasInserted;
     }
-    // If value equals node->data, don't insert (no duplicates)
+    return &node->data;     // rotations relink nodes but never move them
+}
 
-    return node;
+template <class T, bool Balanced, class NodeAllocator>
+template <class Compare>
+T* BinarySearchTree<T, Balanced, NodeAllocator>::findElementBy(Compare compare)
+{
+    nodeType<T>* node = findNodeBy(compare);
+    return node == nullptr ? nullptr : &node->data;
 }
 
-template <class T>
-bool BinarySearchTree<T>::searchElement(const T& value) const
+template <class T, bool Balanced, class NodeAllocator>
+template <class Compare>
+const T* BinarySearchTree<T, Balanced, NodeAllocator>::findElementBy(Compare compare) const
 {
-    return searchRecursive(root, value);
+    nodeType<T>* node = findNodeBy(compare);
+    return node == nullptr ? nullptr : &node->data;
 }
 
-template <class T>
-bool BinarySearchTree<T>::searchRecursive(nodeType<T>* node, const T& value) const
+template <class T, bool Balanced, class NodeAllocator>
+template <class Compare, class Make>
+T* BinarySearchTree<T, Balanced, NodeAllocator>::findOrInsertBy(Compare compare, Make make, bool* inserted)
 {
-    if (node == nullptr)
+    bool wasInserted;
+    nodeType<T>* node = insertNodeBy(compare, make, wasInserted);
+    if (inserted != nullptr)
     {
-        return false;
+        *inserted = wasInserted;
     }
+    return &node->data;
+}
 
-    if (value == node->data)
+template <class T, bool Balanced, class NodeAllocator>
+nodeType<T>* BinarySearchTree<T, Balanced, NodeAllocator>::findNode(const T& value) const
+{
+    return findNodeBy(ValueCompare{value});
+}
+
+template <class T, bool Balanced, class NodeAllocator>
+nodeType<T>* BinarySearchTree<T, Balanced, NodeAllocator>::insertNode(const T& value, bool& inserted)
+{
+    return insertNodeBy(ValueCompare{value}, [&value]() -> const T& { return value; }, inserted);
+}
+
+template <class T, bool Balanced, class NodeAllocator>
+template <class Compare>
+nodeType<T>* BinarySearchTree<T, Balanced, NodeAllocator>::findNodeBy(Compare compare) const
+{
+    nodeType<T>* node = root;
+    while (node != nullptr)
     {
-        return true;
+        int order = compare(node->data);
+        if (order < 0)
+        {
+            node = node->left;
+        }
+        else if (order > 0)
+        {
+            node = node->right;
+        }
+        else
+        {
+            return node;
+        }
     }
+    return nullptr;
+}
 
-    if (value < node->data)
+template <class T, bool Balanced, class NodeAllocator>
+template <class Compare, class Make>
+nodeType<T>* BinarySearchTree<T, Balanced, NodeAllocator>::insertNodeBy(Compare compare, Make make, bool& inserted)
+{
+    // links from the root down to the new node, only needed to rebalance
+    nodeType<T>** path[maxBalancedHeight];
+    int depth = 0;
+
+    nodeType<T>** link = &root;
+    while (*link != nullptr)
     {
-        return searchRecursive(node->left, value);
+        if (Balanced)
+        {
+            path[depth++] = link;
+        }
+
+        nodeType<T>* node = *link;
+        int order = compare(node->data);
+        if (order < 0)
+        {
+            link = &node->left;
+        }
+        else if (order > 0)
+        {
+            link = &node->right;
+        }
+        else
+        {
+            inserted = false;   // If value equals node->data, don't insert (no duplicates)
+            return node;
+        }
     }
-    else
+    nodeType<T>* newNode = nodes.create(make());
+    *link = newNode;
+    inserted = true;
+
+    if (Balanced)
     {
-        return searchRecursive(node->right, value);
+        // walk back up; once a subtree keeps its old height nothing above it changes
+        while (depth > 0)
+        {
+            nodeType<T>** parentLink = path[--depth];
+            int oldHeight = (*parentLink)->height;
+            *parentLink = rebalance(*parentLink);
+            if ((*parentLink)->height == oldHeight)
+            {
+                break;
+            }
+        }
     }
+    return newNode;
 }
 
-template <class T>
-void BinarySearchTree<T>::destroyTree()
+template <class T, bool Balanced, class NodeAllocator>
+void BinarySearchTree<T, Balanced, NodeAllocator>::destroyTree()
 {
-    destroyRecursive(root);
+    nodes.destroyAll(root);
     root = nullptr;
 }
 
-template <class T>
-void BinarySearchTree<T>::destroyRecursive(nodeType<T>* node)
+template <class T, bool Balanced, class NodeAllocator>
+nodeType<T>* BinarySearchTree<T, Balanced, NodeAllocator>::copyTree(const nodeType<T>* node)
 {
+    /// Source node waiting to be copied and the link its copy goes into
+    struct PendingCopy
+    {
+        const nodeType<T>* source;
+        nodeType<T>** target;
+    };
+
+    nodeType<T>* newRoot = nullptr;
+    Vector<PendingCopy> pending;
     if (node != nullptr)
     {
-        destroyRecursive(node->left);
-        destroyRecursive(node->right);
-        delete node;
+        pending.push_back(PendingCopy{node, &newRoot});
     }
-}
 
-template <class T>
-nodeType<T>* BinarySearchTree<T>::copyTree(nodeType<T>* node)
-{
-    if (node == nullptr)
+    while (pending.size() > 0)
     {
-        return nullptr;
+        PendingCopy current = pending[pending.size() - 1];
+        pending.pop_back();
+
+        nodeType<T>* newNode = nodes.create(current.source->data);
+        newNode->height = current.source->height;
+        *current.target = newNode;
+
+        if (current.source->right != nullptr)
+        {
+            pending.push_back(PendingCopy{current.source->right, &newNode->right});
+        }
+        if (current.source->left != nullptr)
+        {
+            pending.push_back(PendingCopy{current.source->left, &newNode->left});
+        }
     }
+    return newRoot;
+}
 
-    nodeType<T>* newNode = new nodeType<T>(node->data);
-    newNode->left = copyTree(node->left);
-    newNode->right = copyTree(node->right);
-    return newNode;
+// AVL balancing for the balanced mode
+template <class T, bool Balanced, class NodeAllocator>
+int BinarySearchTree<T, Balanced, NodeAllocator>::height(nodeType<T>* node)
+{
+    return node == nullptr ? 0 : node->height;
 }
 
-// Traversal implementations with function pointers
-template <class T>
-void BinarySearchTree<T>::inOrderTraversal(f1Typ f1) const
+template <class T, bool Balanced, class NodeAllocator>
+void BinarySearchTree<T, Balanced, NodeAllocator>::updateHeight(nodeType<T>* node)
 {
-    inOrder(f1, root);
+    int leftHeight = height(node->left);
+    int rightHeight = height(node->right);
+    node->height = 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
 }
 
-template <class T>
-void BinarySearchTree<T>::inOrder(f1Typ f1, nodeType<T>* node) const
+template <class T, bool Balanced, class NodeAllocator>
+nodeType<T>* BinarySearchTree<T, Balanced, NodeAllocator>::rotateLeft(nodeType<T>* node)
 {
-    if (node != nullptr)
+    nodeType<T>* pivot = node->right;
+    node->right = pivot->left;
+    pivot->left = node;
+    updateHeight(node);
+    updateHeight(pivot);
+    return pivot;
+}
+
+template <class T, bool Balanced, class NodeAllocator>
+nodeType<T>* BinarySearchTree<T, Balanced, NodeAllocator>::rotateRight(nodeType<T>* node)
+{
+    nodeType<T>* pivot = node->left;
+    node->left = pivot->right;
+    pivot->right = node;
+    updateHeight(node);
+    updateHeight(pivot);
+    return pivot;
+}
+
+template <class T, bool Balanced, class NodeAllocator>
+nodeType<T>* BinarySearchTree<T, Balanced, NodeAllocator>::rebalance(nodeType<T>* node)
+{
+    updateHeight(node);
+    int balance = height(node->left) - height(node->right);
+
+    if (balance > 1)
+    {
+        // left-right case becomes left-left with one extra rotation
+        if (height(node->left->left) < height(node->left->right))
+        {
+            node->left = rotateLeft(node->left);
+        }
+        return rotateRight(node);
+    }
+    if (balance < -1)
     {
-        inOrder(f1, node->left);
-        (*f1)(node->data);
-        inOrder(f1, node->right);
+        // right-left case becomes right-right with one extra rotation
+        if (height(node->right->right) < height(node->right->left))
+        {
+            node->right = rotateRight(node->right);
+        }
+        return rotateLeft(node);
     }
+    return node;
 }
 
-template <class T>
-void BinarySearchTree<T>::preOrderTraversal(f1Typ f1) const
+// Traversal implementations with function pointers, they share the visitor versions
+template <class T, bool Balanced, class NodeAllocator>
+void BinarySearchTree<T, Balanced, NodeAllocator>::inOrderTraversal(f1Typ f1) const
 {
-    preOrder(f1, root);
+    inOrderTraversal<f1Typ>(f1);
 }
 
-template <class T>
-void BinarySearchTree<T>::preOrder(f1Typ f1, nodeType<T>* node) const
+template <class T, bool Balanced, class NodeAllocator>
+void BinarySearchTree<T, Balanced, NodeAllocator>::preOrderTraversal(f1Typ f1) const
 {
-    if (node != nullptr)
+    preOrderTraversal<f1Typ>(f1);
+}
+
+template <class T, bool Balanced, class NodeAllocator>
+void BinarySearchTree<T, Balanced, NodeAllocator>::postOrderTraversal(f1Typ f1) const
+{
+    postOrderTraversal<f1Typ>(f1);
+}
+
+template <class T, bool Balanced, class NodeAllocator>
+template <class Visitor>
+bool BinarySearchTree<T, Balanced, NodeAllocator>::visitNode(Visitor& visit, T& data)
+{
+    return visitNode(visit, data, std::is_same<decltype(visit(data)), bool>());
+}
+
+template <class T, bool Balanced, class NodeAllocator>
+template <class Visitor>
+bool BinarySearchTree<T, Balanced, NodeAllocator>::visitNode(Visitor& visit, T& data, std::true_type)
+{
+    return visit(data);
+}
+
+template <class T, bool Balanced, class NodeAllocator>
+template <class Visitor>
+bool BinarySearchTree<T, Balanced, NodeAllocator>::visitNode(Visitor& visit, T& data, std::false_type)
+{
+    visit(data);
+    return true;
+}
+
+// Traversal implementations with visitors
+// Each keeps its own stack of pending nodes on the heap, so a degenerate
+// (list shaped) tree costs memory but can never overflow the call stack.
+template <class T, bool Balanced, class NodeAllocator>
+template <class Visitor>
+bool BinarySearchTree<T, Balanced, NodeAllocator>::inOrderTraversal(Visitor visit) const
+{
+    Vector<nodeType<T>*> pending;
+    nodeType<T>* node = root;
+    while (node != nullptr || pending.size() > 0)
     {
-        (*f1)(node->data);
-        preOrder(f1, node->left);
-        preOrder(f1, node->right);
+        while (node != nullptr)
+        {
+            pending.push_back(node);
+            node = node->left;
+        }
+        node = pending[pending.size() - 1];
+        pending.pop_back();
+        if (!visitNode(visit, node->data))
+        {
+            return false;
+        }
+        node = node->right;
     }
+    return true;
 }
 
-template <class T>
-void BinarySearchTree<T>::postOrderTraversal(f1Typ f1) const
+template <class T, bool Balanced, class NodeAllocator>
+template <class Visitor>
+bool BinarySearchTree<T, Balanced, NodeAllocator>::preOrderTraversal(Visitor visit) const
 {
-    postOrder(f1, root);
+    Vector<nodeType<T>*> pending;
+    if (root != nullptr)
+    {
+        pending.push_back(root);
+    }
+    while (pending.size() > 0)
+    {
+        nodeType<T>* node = pending[pending.size() - 1];
+        pending.pop_back();
+        if (!visitNode(visit, node->data))
+        {
+            return false;
+        }
+        if (node->right != nullptr)
+        {
+            pending.push_back(node->right);
+        }
+        if (node->left != nullptr)
+        {
+            pending.push_back(node->left);
+        }
+    }
+    return true;
 }
 
-template <class T>
-void BinarySearchTree<T>::postOrder(f1Typ f1, nodeType<T>* node) const
+template <class T, bool Balanced, class NodeAllocator>
+template <class Visitor>
+bool BinarySearchTree<T, Balanced, NodeAllocator>::postOrderTraversal(Visitor visit) const
 {
-    if (node != nullptr)
+    Vector<nodeType<T>*> pending;
+    nodeType<T>* node = root;
+    nodeType<T>* lastVisited = nullptr;
+    while (node != nullptr || pending.size() > 0)
     {
-        postOrder(f1, node->left);
-        postOrder(f1, node->right);
-        (*f1)(node->data);
+        while (node != nullptr)
+        {
+            pending.push_back(node);
+            node = node->left;
+        }
+        nodeType<T>* top = pending[pending.size() - 1];
+        if (top->right != nullptr && top->right != lastVisited)
+        {
+            node = top->right;      // right subtree still to do
+        }
+        else
+        {
+            if (!visitNode(visit, top->data))
+            {
+                return false;
+            }
+            lastVisited = top;
+            pending.pop_back();
+        }
     }
+    return true;
 }
 
 #endif // BST_H
@@ -1,13 +1,13 @@
 #include "date.h"
-#include <sstream>
+#include "fastParse.h"
 
 Date::Date() : day(1), month(1), year(2000) {}
 Date::Date(int d, int m, int y) : day(d), month(m), year(y) {}
 
-Date::Date(const std::string & dateStr){
-  std::stringstream ss(dateStr);
-  char slash;
-  ss >> day >> slash >> month >> slash >> year;
+Date::Date(const std::string & dateStr) : Date(dateStr.data(), dateStr.data() + dateStr.size()) {}
+
+Date::Date(const char * first, const char * last) : day(0), month(0), year(0) {
+  fastParse::parseDate(first, last, day, month, year);
 }
 
 int Date::GetDay() const { return day; }
@@ -35,6 +35,13 @@ public:
      */
     Date(const std::string & dateStr);
 
+    /**
+     * @brief Constructor to initialize date from a character range (format: DD/MM/YYYY).
+     * @param first First character of the date.
+     * @param last One past the last character of the date.
+     */
+    Date(const char * first, const char * last);
+
     /**
      * @brief Gets the day.
      * @return Day value.
@@ -0,0 +1,210 @@
+/**
+ * @file fastParse.cpp
+ * @brief Implementation of the allocation free character range parsers
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ */
+
+#include "fastParse.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <climits>
+
+namespace fastParse {
+
+    namespace {
+        // Powers of ten that are exact in a double
+        const double exactPowersOfTen[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        inline bool isDigit(char c) {
+            return c >= '0' && c <= '9';
+        }
+
+        inline bool isSpace(char c) {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+        }
+
+        // Skips whitespace and takes one separator character, like ss >> charVariable
+        inline bool skipSeparator(const char * & p, const char * last) {
+            while (p < last && isSpace(*p)) ++p;
+            if (p == last) {
+                return false;
+            }
+            ++p;
+            return true;
+        }
+
+        // Slow path for what the fast path cannot convert exactly, copied to the stack
+        float parseWithStrtod(const char * first, const char * last) {
+            char buffer[64];
+            std::size_t length = last - first;
+            if (length >= sizeof(buffer)) {
+                length = sizeof(buffer) - 1;
+            }
+            std::memcpy(buffer, first, length);
+            buffer[length] = '\0';
+            return static_cast<float>(std::strtod(buffer, nullptr));
+        }
+    }
+
+    bool parseFloat(const char * first, const char * last, float & value) {
+        value = 0.0f;
+
+        const char * p = first;
+        while (p < last && isSpace(*p)) ++p;
+        const char * numberStart = p;
+
+        bool negative = false;
+        if (p < last && (*p == '-' || *p == '+')) {
+            negative = (*p == '-');
+            ++p;
+        }
+
+        std::uint64_t mantissa = 0;
+        int significantDigits = 0;
+        int exponent = 0;
+        bool anyDigit = false;
+        bool truncated = false;
+
+        for (; p < last && isDigit(*p); ++p) {
+            anyDigit = true;
+            if (mantissa == 0 && *p == '0') {
+                continue; // leading zero
+            }
+            if (significantDigits < 19) {
+                mantissa = mantissa * 10 + (*p - '0');
+                significantDigits++;
+            } else {
+                exponent++;
+                truncated = true;
+            }
+        }
+
+        if (p < last && *p == '.') {
+            for (++p; p < last && isDigit(*p); ++p) {
+                anyDigit = true;
+                if (mantissa == 0 && *p == '0') {
+                    exponent--;
+                } else if (significantDigits < 19) {
+                    mantissa = mantissa * 10 + (*p - '0');
+                    significantDigits++;
+                    exponent--;
+                } else {
+                    truncated = true;
+                }
+            }
+        }
+
+        if (!anyDigit) {
+            // "inf", "nan" and friends
+            if (p < last && ((*p | 0x20) == 'i' || (*p | 0x20) == 'n')) {
+                value = parseWithStrtod(numberStart, last);
+                return true;
+            }
+            return false;
+        }
+
+        // "0x..." is a hex float for atof
+        if (p < last && (*p | 0x20) == 'x') {
+            value = parseWithStrtod(numberStart, last);
+            return true;
+        }
+
+        if (p < last && (*p | 0x20) == 'e') {
+            const char * q = p + 1;
+            bool negativeExponent = false;
+            if (q < last && (*q == '-' || *q == '+')) {
+                negativeExponent = (*q == '-');
+                ++q;
+            }
+            if (q < last && isDigit(*q)) {
+                int exponentValue = 0;
+                for (; q < last && isDigit(*q); ++q) {
+                    if (exponentValue < 10000) {
+                        exponentValue = exponentValue * 10 + (*q - '0');
+                    }
+                }
+                exponent += negativeExponent ? -exponentValue : exponentValue;
+                p = q;
+            }
+        }
+
+        if (mantissa == 0) {
+            value = negative ? -0.0f : 0.0f;
+            return true;
+        }
+
+        // one multiply or divide of two exact doubles is correctly rounded, same as strtod
+        if (truncated || mantissa > (std::uint64_t(1) << 53) || exponent > 22 || exponent < -22) {
+            value = parseWithStrtod(numberStart, p);
+            return true;
+        }
+
+        double result = static_cast<double>(mantissa);
+        if (exponent < 0) {
+            result /= exactPowersOfTen[-exponent];
+        } else {
+            result *= exactPowersOfTen[exponent];
+        }
+        value = static_cast<float>(negative ? -result : result);
+        return true;
+    }
+
+    bool parseInt(const char * & first, const char * last, int & value) {
+        const char * p = first;
+        while (p < last && isSpace(*p)) ++p;
+
+        bool negative = false;
+        if (p < last && (*p == '-' || *p == '+')) {
+            negative = (*p == '-');
+            ++p;
+        }
+        if (p == last || !isDigit(*p)) {
+            return false;
+        }
+
+        // saturate instead of overflowing, like operator>> does
+        long long result = 0;
+        for (; p < last && isDigit(*p); ++p) {
+            if (result <= INT_MAX) {
+                result = result * 10 + (*p - '0');
+            }
+        }
+        if (result > INT_MAX) {
+            result = INT_MAX;
+        }
+        value = static_cast<int>(negative ? -result : result);
+        first = p;
+        return true;
+    }
+
+    bool parseDate(const char * first, const char * last, int & day, int & month, int & year) {
+        return parseInt(first, last, day) &&
+               skipSeparator(first, last) &&
+               parseInt(first, last, month) &&
+               skipSeparator(first, last) &&
+               parseInt(first, last, year);
+    }
+
+    bool parseTime(const char * first, const char * last, int & hour, int & min, int & sec) {
+        sec = 0;
+        if (!parseInt(first, last, hour) ||
+            !skipSeparator(first, last) ||
+            !parseInt(first, last, min)) {
+            return false;
+        }
+
+        // seconds are optional, MetData only has HH:MM
+        const char * p = first;
+        int seconds;
+        if (skipSeparator(p, last) && parseInt(p, last, seconds)) {
+            sec = seconds;
+        }
+        return true;
+    }
+
+} // namespace fastParse
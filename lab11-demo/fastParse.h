@@ -0,0 +1,68 @@
+#ifndef FAST_PARSE_H
+#define FAST_PARSE_H
+
+/**
+ * @file fastParse.h
+ * @brief Allocation free parsers for numbers, dates and times in character ranges
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ *
+ * Every parser works on a [first, last) range, so fields can be read straight
+ * out of a mapped file without building a std::string or std::stringstream.
+ * None of them depend on the C locale.
+ */
+
+/**
+ * @namespace fastParse
+ * @brief Character range parsers used by the CSV loader, Date and Time
+ */
+namespace fastParse {
+    /**
+     * @brief Parses a decimal number such as "12.5", "-3", ".5" or "1e3"
+     *
+     * Follows atof: leading whitespace is skipped, parsing stops at the first
+     * character that cannot continue the number, and an unparsable range gives 0.
+     * Up to 19 significant digits with a power of ten up to 22 are converted
+     * exactly, which covers every MetData value; anything longer, as well as
+     * "inf", "nan" and hex floats, goes through strtod.
+     *
+     * @param first First character
+     * @param last One past the last character
+     * @param value Output value, 0 if no number was found
+     * @return true if at least one digit was read
+     */
+    bool parseFloat(const char * first, const char * last, float & value);
+
+    /**
+     * @brief Parses an optionally signed integer, advancing first past it
+     * @param first Current position, moved past the number on success
+     * @param last One past the last character
+     * @param value Output value
+     * @return true if at least one digit was read
+     */
+    bool parseInt(const char * & first, const char * last, int & value);
+
+    /**
+     * @brief Parses a date in DD/MM/YYYY form (single digit day and month allowed)
+     * @param first First character
+     * @param last One past the last character
+     * @param day Output day
+     * @param month Output month
+     * @param year Output year
+     * @return true if all three parts were read
+     */
+    bool parseDate(const char * first, const char * last, int & day, int & month, int & year);
+
+    /**
+     * @brief Parses a time in HH:MM or HH:MM:SS form (single digit hour allowed)
+     * @param first First character
+     * @param last One past the last character
+     * @param hour Output hour
+     * @param min Output minute
+     * @param sec Output second, 0 when the range has no seconds
+     * @return true if at least the hour and minute were read
+     */
+    bool parseTime(const char * first, const char * last, int & hour, int & min, int & sec);
+}
+
+#endif // FAST_PARSE_H
@@ -1,11 +1,91 @@
 #include "loadWeatherData.h"
+#include "parallelFor.h"
+#include "weatherCache.h"
+#include "fastParse.h"
+#include "weatherTable.h"
 #include <fstream>
 #include <sstream>
 #include <iostream>
 #include <string>
-#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <limits>
+#include <utility>
 
-loadWeatherData::loadWeatherData(){}
+namespace {
+    // A WAST date that does not parse leaves Date at 0/0/0 (or partly set);
+    // such a row belongs to no month, so it is skipped like a missing value
+    bool isValidDate(const Date & date) {
+        return date.GetMonth() >= 1 && date.GetMonth() <= 12 &&
+               date.GetDay() >= 1 && date.GetDay() <= 31;
+    }
+
+    // Copies the records of one file or chunk to the end of the combined result,
+    // WeatherRecord is trivially copyable so this is one memcpy
+    void appendRecords(Vector<WeatherRecord> & records, Vector<WeatherRecord> & block) {
+        records.append(block.begin(), block.size());
+    }
+
+    void appendRecords(WeatherTable & table, WeatherTable & block) {
+        table.append(block);
+    }
+
+    void appendRecords(WeatherSummary & summary, WeatherSummary & block) {
+        summary.merge(block);
+    }
+
+    // Gives an empty result the storage of the first block instead of copying it
+    template <class Records>
+    void takeOverRecords(Records & records, Records & block) {
+        records = std::move(block);
+    }
+
+    void takeOverRecords(WeatherSummary & summary, WeatherSummary & block) {
+        summary.merge(block);
+    }
+
+    // Appends the blocks of every file or chunk in order. An empty result takes
+    // the first block over whole; the storage then grows once and the other
+    // blocks are copied into it in bulk
+    template <class Records>
+    void mergeBlocks(Records & records, Records * blocks, int blockCount) {
+        int total = records.size();
+        for (int i = 0; i < blockCount; i++) {
+            total += blocks[i].size();
+        }
+
+        int next = 0;
+        if (records.size() == 0 && blockCount > 0) {
+            takeOverRecords(records, blocks[0]);
+            next = 1;
+        }
+        records.reserve(total);
+        for (int i = next; i < blockCount; i++) {
+            appendRecords(records, blocks[i]);
+        }
+    }
+
+    // Snapshots hold rows, so only the loaders that keep rows write them
+    template <class Records>
+    bool writeSnapshot(const std::string & filename, const weatherCache::SourceStamp & stamp,
+                       const Records & records, int first) {
+        return weatherCache::writeCache(filename, stamp, records, first);
+    }
+
+    bool writeSnapshot(const std::string &, const weatherCache::SourceStamp &, const WeatherSummary &, int) {
+        return false;
+    }
+}
+
+loadWeatherData::loadWeatherData(LoadMode mode) : loadMode(mode), cacheEnabled(false) {}
+
+void loadWeatherData::setLoadMode(LoadMode mode){
+    loadMode = mode;
+}
+
+void loadWeatherData::setCacheEnabled(bool enabled){
+    cacheEnabled = enabled;
+}
 
 std::string loadWeatherData::getDataSourceFilename(){
     std::ifstream sourceFile("data/data_source.txt");
@@ -21,7 +101,114 @@ std::string loadWeatherData::getDataSourceFilename(){
     return "data/" + filename;
 }
 
+bool loadWeatherData::getDataSourceFilenames(Vector<std::string> & filenames){
+    std::ifstream sourceFile("data/data_source.txt");
+    if (!sourceFile){
+        std::cerr << "cannot open data_source.txt" << std::endl;
+        return false;
+    }
+
+    std::string filename;
+    while (std::getline(sourceFile, filename)) {
+        filenames.push_back(filename);
+    }
+    sourceFile.close();
+    return true;
+}
+
+int loadWeatherData::loadFiles(const Vector<std::string> & filenames, Vector<WeatherRecord> & records,
+                               Vector<int> & recordCounts, int threadCount){
+    return loadFilesInto(filenames, records, recordCounts, threadCount);
+}
+
+int loadWeatherData::loadFiles(const Vector<std::string> & filenames, WeatherTable & table,
+                               Vector<int> & recordCounts, int threadCount){
+    return loadFilesInto(filenames, table, recordCounts, threadCount);
+}
+
+int loadWeatherData::loadFiles(const Vector<std::string> & filenames, WeatherSummary & summary,
+                               Vector<int> & recordCounts, int threadCount){
+    return loadFilesInto(filenames, summary, recordCounts, threadCount);
+}
+
+template <class Records>
+int loadWeatherData::loadFilesInto(const Vector<std::string> & filenames, Records & records,
+                                   Vector<int> & recordCounts, int threadCount){
+    int fileCount = filenames.size();
+    Records * fileRecords = new Records[fileCount];
+    bool * loaded = new bool[fileCount];
+
+    // the file workers share the thread budget, so a chunked parse inside one
+    // of them gets its share instead of starting a pool per hardware thread
+    int fileWorkers = workerCount(fileCount, threadCount);
+    int threadsPerFile = workerCount(std::numeric_limits<int>::max(), threadCount) / fileWorkers;
+
+    // every worker only writes to the slots of the file it is parsing
+    parallelFor(fileCount, [&](int i) {
+        loaded[i] = loadInto(filenames[i], fileRecords[i], threadsPerFile);
+    }, fileWorkers);
+
+    // counted before the merge, which may take a block's storage over
+    int filesLoaded = 0;
+    for (int i = 0; i < fileCount; i++) {
+        recordCounts.push_back(loaded[i] ? fileRecords[i].size() : -1);
+        if (loaded[i]) {
+            filesLoaded++;
+        }
+    }
+    mergeBlocks(records, fileRecords, fileCount);
+
+    delete[] fileRecords;
+    delete[] loaded;
+    return filesLoaded;
+}
+
 bool loadWeatherData::loadData(const std::string & filename, Vector<WeatherRecord> & records){
+    return loadInto(filename, records, 0);
+}
+
+bool loadWeatherData::loadData(const std::string & filename, WeatherTable & table){
+    return loadInto(filename, table, 0);
+}
+
+bool loadWeatherData::loadData(const std::string & filename, WeatherSummary & summary){
+    return loadInto(filename, summary, 0);
+}
+
+template <class Records>
+bool loadWeatherData::loadInto(const std::string & filename, Records & records, int threadCount){
+    if (cacheEnabled && weatherCache::readCache(filename, records)) {
+        return true;
+    }
+
+    // stamped before parsing: if the CSV changes meanwhile, the snapshot
+    // carries the old stamp and the next run parses the file again
+    weatherCache::SourceStamp stamp;
+    bool stamped = cacheEnabled && weatherCache::readSourceStamp(filename, stamp);
+
+    int first = records.size();
+    bool loaded;
+    if (loadMode == LoadMode::Mapped) {
+        loaded = parseMapped(filename, records);
+    } else if (loadMode == LoadMode::Chunked) {
+        loaded = parseChunked(filename, records, threadCount);
+    } else {
+        loaded = parseStream(filename, records);
+    }
+
+    // a failed snapshot write only costs the next run a reparse
+    if (loaded && stamped) {
+        writeSnapshot(filename, stamp, records, first);
+    }
+    return loaded;
+}
+
+bool loadWeatherData::loadDataStream(const std::string & filename, Vector<WeatherRecord> & records){
+    return parseStream(filename, records);
+}
+
+template <class Records>
+bool loadWeatherData::parseStream(const std::string & filename, Records & records){
     std::ifstream file(filename);
     if(!file) {
         std::cerr << "Cannot open the file " << filename << std::endl;
@@ -35,60 +222,48 @@ bool loadWeatherData::loadData(const std::string & filename, Vector<WeatherRecor
         return false;
     }
 
-    Vector<std::string> headers;
-    parseCSVLine(headerLine, headers);
-
-    // Find the indexes of the required columns
-    int wastIndex = findColumnIndex(headers, "WAST");
-    int sIndex = findColumnIndex(headers, "S");
-    int tIndex = findColumnIndex(headers, "T");
-    int srIndex = findColumnIndex(headers, "SR");
-
-    if (wastIndex == -1 || sIndex == -1 || tIndex == -1 || srIndex == -1) {
-        std::cerr << "Cannot find required columns in the header file" << std::endl;
+    ColumnLayout layout;
+    if (!readColumnLayout(headerLine, layout)) {
         return false;
     }
 
-    int maxIndex = wastIndex;
-    if (sIndex > maxIndex) maxIndex = sIndex;
-    if (tIndex > maxIndex) maxIndex = tIndex;
-    if (srIndex > maxIndex) maxIndex = srIndex;
-
     //read the data lines
     std::string line;
     while (std::getline(file, line)){
         Vector<std::string> fields;
         parseCSVLine(line, fields);
 
-        if (fields.size() <= maxIndex){
+        if (fields.size() <= layout.maxIndex){
             continue;
         } // skip lines with incomplete data
 
         //skip lines with missing data
-        if (isMissingData(fields[sIndex]) ||
-            isMissingData(fields[tIndex]) ||
-            isMissingData(fields[srIndex])) {
+        if (isMissingData(fields[layout.sIndex]) ||
+            isMissingData(fields[layout.tIndex]) ||
+            isMissingData(fields[layout.srIndex])) {
             continue;
         }
 
         //parse date and time from WAST field
-        std::string datetime = fields[wastIndex];
+        std::string datetime = fields[layout.wastIndex];
         std::stringstream dtStream(datetime);
         std::string dateStr, timeStr;
         dtStream >> dateStr >> timeStr;
 
         Date date(dateStr);
         Time time(timeStr);
+        if (!isValidDate(date)) {
+            continue;
+        }
 
         // parse numeric values
-        float windSpeed = stringToFloat(fields[sIndex]);
-        float temperature = stringToFloat(fields[tIndex]);
-        float solarRadiation = stringToFloat(fields[srIndex]);
+        float windSpeed = stringToFloat(fields[layout.sIndex]);
+        float temperature = stringToFloat(fields[layout.tIndex]);
+        float solarRadiation = stringToFloat(fields[layout.srIndex]);
 
         // filter solar radiation only >= 100 W/m2
         if (solarRadiation >= 100.0f){
-            WeatherRecord record(date, time, windSpeed, temperature, solarRadiation);
-            records.push_back(record);
+            records.emplace_back(date, time, windSpeed, temperature, solarRadiation);
         }
     }
 
@@ -96,6 +271,214 @@ bool loadWeatherData::loadData(const std::string & filename, Vector<WeatherRecor
     return true;
 }
 
+bool loadWeatherData::loadDataMapped(const std::string & filename, Vector<WeatherRecord> & records){
+    return parseMapped(filename, records);
+}
+
+template <class Records>
+bool loadWeatherData::parseMapped(const std::string & filename, Records & records){
+    MappedFile file;
+    ColumnLayout layout;
+    const char * dataFirst;
+    if (!openMapped(filename, file, layout, dataFirst)) {
+        return false;
+    }
+
+    parseMappedRange(dataFirst, file.end(), layout, records);
+    return true;
+}
+
+bool loadWeatherData::loadDataChunked(const std::string & filename, Vector<WeatherRecord> & records,
+                                      int threadCount){
+    return parseChunked(filename, records, threadCount);
+}
+
+template <class Records>
+bool loadWeatherData::parseChunked(const std::string & filename, Records & records, int threadCount){
+    MappedFile file;
+    ColumnLayout layout;
+    const char * dataFirst;
+    if (!openMapped(filename, file, layout, dataFirst)) {
+        return false;
+    }
+
+    // below this a chunk costs more in thread start up than it saves
+    const std::size_t minChunkBytes = 1 << 20;
+    const char * dataLast = file.end();
+    std::size_t dataBytes = dataLast - dataFirst;
+
+    int workers = workerCount(static_cast<int>(dataBytes / minChunkBytes), threadCount);
+    if (workers == 1) {
+        parseMappedRange(dataFirst, dataLast, layout, records);
+        return true;
+    }
+
+    // a few chunks per worker so a slow chunk does not hold the others up
+    int chunkCount = workers * 4;
+    if (static_cast<std::size_t>(chunkCount) > dataBytes / minChunkBytes) {
+        chunkCount = static_cast<int>(dataBytes / minChunkBytes);
+    }
+
+    // move every cut forward to just after the next newline so no line is split
+    const char ** bounds = new const char *[chunkCount + 1];
+    bounds[0] = dataFirst;
+    bounds[chunkCount] = dataLast;
+    for (int i = 1; i < chunkCount; i++) {
+        const char * cut = dataFirst + dataBytes / chunkCount * i;
+        if (cut < bounds[i - 1]) {
+            cut = bounds[i - 1];
+        }
+        const char * newline = static_cast<const char *>(std::memchr(cut, '\n', dataLast - cut));
+        bounds[i] = (newline == nullptr) ? dataLast : newline + 1;
+    }
+
+    Records * chunkRecords = new Records[chunkCount];
+    parallelFor(chunkCount, [&](int i) {
+        parseMappedRange(bounds[i], bounds[i + 1], layout, chunkRecords[i]);
+    }, workers);
+
+    mergeBlocks(records, chunkRecords, chunkCount);
+
+    delete[] chunkRecords;
+    delete[] bounds;
+    return true;
+}
+
+bool loadWeatherData::openMapped(const std::string & filename, MappedFile & file, ColumnLayout & layout,
+                                 const char * & dataFirst){
+    if (!file.open(filename)) {
+        std::cerr << "Cannot open the file " << filename << std::endl;
+        return false;
+    }
+
+    const char * pos = file.begin();
+    const char * end = file.end();
+    if (pos == end) {
+        std::cerr << "Cannot read the header line from the file" << std::endl;
+        return false;
+    }
+
+    // the header is read once, so it can go through the normal string parser
+    const char * headerEnd = static_cast<const char *>(std::memchr(pos, '\n', end - pos));
+    if (headerEnd == nullptr) {
+        headerEnd = end;
+    }
+    const char * headerLast = headerEnd;
+    if (headerLast > pos && headerLast[-1] == '\r') {
+        --headerLast;
+    }
+
+    if (!readColumnLayout(std::string(pos, headerLast), layout)) {
+        return false;
+    }
+
+    dataFirst = (headerEnd == end) ? end : headerEnd + 1;
+    return true;
+}
+
+template <class Records>
+void loadWeatherData::parseMappedRange(const char * first, const char * last, const ColumnLayout & layout,
+                                       Records & records){
+    const char * pos = first;
+    while (pos < last) {
+        const char * lineEnd = static_cast<const char *>(std::memchr(pos, '\n', last - pos));
+        if (lineEnd == nullptr) {
+            lineEnd = last;
+        }
+        const char * next = (lineEnd == last) ? last : lineEnd + 1;
+
+        // same as text mode getline on Windows, drop the CR of a CRLF ending
+        if (lineEnd > pos && lineEnd[-1] == '\r') {
+            --lineEnd;
+        }
+
+        FieldView wast, s, t, sr;
+        if (extractFields(pos, lineEnd, layout, wast, s, t, sr) &&
+            !isMissingData(s) && !isMissingData(t) && !isMissingData(sr)) {
+
+            // WAST holds "date time", split on whitespace like operator>> does
+            const char * p = wast.first;
+            while (p < wast.last && std::isspace(static_cast<unsigned char>(*p))) ++p;
+            const char * dateFirst = p;
+            while (p < wast.last && !std::isspace(static_cast<unsigned char>(*p))) ++p;
+            const char * dateLast = p;
+            while (p < wast.last && std::isspace(static_cast<unsigned char>(*p))) ++p;
+            const char * timeFirst = p;
+            while (p < wast.last && !std::isspace(static_cast<unsigned char>(*p))) ++p;
+            const char * timeLast = p;
+
+            float solarRadiation = stringToFloat(sr);
+
+            // filter solar radiation only >= 100 W/m2
+            if (solarRadiation >= 100.0f) {
+                Date date(dateFirst, dateLast);
+                Time time(timeFirst, timeLast);
+                if (isValidDate(date)) {
+                    float windSpeed = stringToFloat(s);
+                    float temperature = stringToFloat(t);
+                    records.emplace_back(date, time, windSpeed, temperature, solarRadiation);
+                }
+            }
+        }
+
+        pos = next;
+    }
+}
+
+bool loadWeatherData::extractFields(const char * first, const char * last, const ColumnLayout & layout,
+                                    FieldView & wast, FieldView & s, FieldView & t, FieldView & sr){
+    int index = 0;
+    const char * fieldStart = first;
+    for (const char * p = first; ; ++p) {
+        if (p != last && *p != ',') {
+            continue;
+        }
+
+        // getline(ss, field, ',') does not produce an empty trailing field
+        if (p == last && p == fieldStart) {
+            return false;
+        }
+
+        FieldView field = { fieldStart, p };
+        if (index == layout.wastIndex) wast = field;
+        if (index == layout.sIndex) s = field;
+        if (index == layout.tIndex) t = field;
+        if (index == layout.srIndex) sr = field;
+
+        // fields after the last required column are never looked at
+        if (index == layout.maxIndex) {
+            return true;
+        }
+        if (p == last) {
+            return false;
+        }
+        ++index;
+        fieldStart = p + 1;
+    }
+}
+
+bool loadWeatherData::readColumnLayout(const std::string & headerLine, ColumnLayout & layout){
+    Vector<std::string> headers;
+    parseCSVLine(headerLine, headers);
+
+    // Find the indexes of the required columns
+    layout.wastIndex = findColumnIndex(headers, "WAST");
+    layout.sIndex = findColumnIndex(headers, "S");
+    layout.tIndex = findColumnIndex(headers, "T");
+    layout.srIndex = findColumnIndex(headers, "SR");
+
+    if (layout.wastIndex == -1 || layout.sIndex == -1 || layout.tIndex == -1 || layout.srIndex == -1) {
+        std::cerr << "Cannot find required columns in the header file" << std::endl;
+        return false;
+    }
+
+    layout.maxIndex = layout.wastIndex;
+    if (layout.sIndex > layout.maxIndex) layout.maxIndex = layout.sIndex;
+    if (layout.tIndex > layout.maxIndex) layout.maxIndex = layout.tIndex;
+    if (layout.srIndex > layout.maxIndex) layout.maxIndex = layout.srIndex;
+    return true;
+}
+
 int loadWeatherData::findColumnIndex(const Vector<std::string> & headers, const std::string & targetHeader) {
     for (int i = 0; i < headers.size(); ++i) {
         if (headers[i] == targetHeader) {
@@ -109,7 +492,7 @@ void loadWeatherData::parseCSVLine(const std::string & line, Vector<std::string>
     std::stringstream ss(line);
     std::string field;
     while (std::getline(ss, field, ',')) {
-        fields.push_back(field);
+        fields.push_back(std::move(field));
     }
 }
 
@@ -117,9 +500,21 @@ bool loadWeatherData::isMissingData(const std::string & value) {
     return value.empty() || value == "NA" || value == "N/A";
 }
 
+bool loadWeatherData::isMissingData(const FieldView & field) {
+    std::size_t length = field.last - field.first;
+    return length == 0 ||
+           (length == 2 && std::memcmp(field.first, "NA", 2) == 0) ||
+           (length == 3 && std::memcmp(field.first, "N/A", 3) == 0);
+}
+
 float loadWeatherData::stringToFloat(const std::string & str) {
-    if (str.empty()) {
-        return 0.0f;
-    }
-    return static_cast<float>(atof(str.c_str()));
+    float value;
+    fastParse::parseFloat(str.data(), str.data() + str.size(), value);
+    return value;
+}
+
+float loadWeatherData::stringToFloat(const FieldView & field) {
+    float value;
+    fastParse::parseFloat(field.first, field.last, value);
+    return value;
 }
@@ -3,6 +3,9 @@
 
 #include "vector.h"
 #include "weatherRecord.h"
+#include "weatherTable.h"
+#include "weatherSummary.h"
+#include "mappedFile.h"
 #include <string>
 
 /**
@@ -12,6 +15,15 @@
  * @date 20/06/2025
  */
 
+/**
+ * @struct FieldView
+ * @brief Non-owning view of one CSV field inside a mapped file
+ */
+struct FieldView {
+    const char * first;     // First character of the field
+    const char * last;      // One past the last character of the field
+};
+
  /**
  * @class loadWeatherData
  * @brief Handles loading and parsing of weather data from CSV files
@@ -19,26 +31,274 @@
 class loadWeatherData {
 public:
 
+    /**
+     * @brief How loadData reads a file
+     *
+     * Stream reads line by line through std::getline and splits every field into a
+     * std::string. Mapped maps the whole file into memory and tokenizes it in place,
+     * only looking at the WAST, S, T and SR columns. Chunked is Mapped with the file
+     * split into line aligned byte ranges that are parsed on separate threads.
+     */
+    enum class LoadMode { Stream, Mapped, Chunked };
+
     /**
      * @brief Default constructor
+     * @param mode Loading mode used by loadData
+     */
+    loadWeatherData(LoadMode mode = LoadMode::Stream);
+
+    /**
+     * @brief Sets the loading mode used by loadData
+     * @param mode Loading mode
+     */
+    void setLoadMode(LoadMode mode);
+
+    /**
+     * @brief Turns the binary snapshot next to each CSV file on or off
+     *
+     * When enabled, loadData first tries "<file>.cache" and only parses the CSV if
+     * the snapshot is missing or stale, writing a fresh snapshot afterwards.
+     *
+     * @param enabled true to read and write snapshots
      */
-    loadWeatherData();
+    void setCacheEnabled(bool enabled);
 
     /**
-     * @brief Loads weather data from a CSV file
+     * @brief Loads weather data from a CSV file using the current loading mode (or its snapshot)
      * @param filename Path to the CSV file to load
      * @param records Vector to store the loaded weather records
      * @return true if data loaded successfully, false on error
      */
     bool loadData(const std::string & filename, Vector<WeatherRecord> & records);
 
+    /**
+     * @brief Loads weather data from a CSV file (or its snapshot) into columns
+     *
+     * Same as the Vector<WeatherRecord> version, but every parsed row goes
+     * straight into the table columns without building a WeatherRecord.
+     *
+     * @param filename Path to the CSV file to load
+     * @param table Table to append the loaded rows to
+     * @return true if data loaded successfully, false on error
+     */
+    bool loadData(const std::string & filename, WeatherTable & table);
+
+    /**
+     * @brief Streams a CSV file (or its snapshot) into per-month running statistics
+     *
+     * Every parsed row is added to its month in summary and dropped, so memory
+     * does not grow with the file. Snapshots are read but never written in
+     * this mode, as no rows are kept to write.
+     *
+     * @param filename Path to the CSV file to load
+     * @param summary Summary to add the rows to
+     * @return true if data loaded successfully, false on error
+     */
+    bool loadData(const std::string & filename, WeatherSummary & summary);
+
+    /**
+     * @brief Loads weather data from a CSV file through std::getline
+     * @param filename Path to the CSV file to load
+     * @param records Vector to store the loaded weather records
+     * @return true if data loaded successfully, false on error
+     */
+    bool loadDataStream(const std::string & filename, Vector<WeatherRecord> & records);
+
+    /**
+     * @brief Loads weather data from a memory mapped CSV file without copying fields
+     * @param filename Path to the CSV file to load
+     * @param records Vector to store the loaded weather records
+     * @return true if data loaded successfully, false on error
+     */
+    bool loadDataMapped(const std::string & filename, Vector<WeatherRecord> & records);
+
+    /**
+     * @brief Loads one memory mapped CSV file by parsing line aligned chunks in parallel
+     *
+     * The data lines are cut into byte ranges that start and end on a newline,
+     * every range is parsed on its own worker with the column layout read from the
+     * header, and the per-chunk records are appended in file order. The result is
+     * identical to loadDataMapped. Small files are parsed on the calling thread.
+     *
+     * @param filename Path to the CSV file to load
+     * @param records Vector to store the loaded weather records
+     * @param threadCount Number of worker threads, 0 uses one per hardware thread
+     * @return true if data loaded successfully, false on error
+     */
+    bool loadDataChunked(const std::string & filename, Vector<WeatherRecord> & records, int threadCount = 0);
+
     /**
      * @brief Gets the data source filename from configuration file
      * @return Full path to the data file, or empty string on error
      */
     std::string getDataSourceFilename();
 
+    /**
+     * @brief Gets every data file listed in the configuration file
+     * @param filenames Vector to store the filenames, one per line of data_source.txt (relative to data/)
+     * @return true if the configuration file could be read
+     */
+    bool getDataSourceFilenames(Vector<std::string> & filenames);
+
+    /**
+     * @brief Loads several CSV files at the same time on a pool of worker threads
+     *
+     * Each file is parsed on its own worker with the current loading mode. The
+     * results are then appended to records in the order of filenames, after
+     * growing records once to the combined size.
+     *
+     * @param filenames Paths of the CSV files to load
+     * @param records Vector to append the records of all files to
+     * @param recordCounts Output number of records loaded per file, -1 if the file failed
+     * @param threadCount Number of worker threads, 0 uses one per hardware thread
+     * @return Number of files loaded successfully
+     */
+    int loadFiles(const Vector<std::string> & filenames, Vector<WeatherRecord> & records,
+                  Vector<int> & recordCounts, int threadCount = 0);
+
+    /**
+     * @brief Loads several CSV files at the same time into one columnar table
+     * @param filenames Paths of the CSV files to load
+     * @param table Table to append the rows of all files to, in the order of filenames
+     * @param recordCounts Output number of records loaded per file, -1 if the file failed
+     * @param threadCount Number of worker threads, 0 uses one per hardware thread
+     * @return Number of files loaded successfully
+     */
+    int loadFiles(const Vector<std::string> & filenames, WeatherTable & table,
+                  Vector<int> & recordCounts, int threadCount = 0);
+
+    /**
+     * @brief Streams several CSV files at the same time into one summary
+     *
+     * Each worker fills a summary of its own file, which are merged in the
+     * order of filenames, so memory is O(files * months) rather than O(rows).
+     *
+     * @param filenames Paths of the CSV files to load
+     * @param summary Summary to add the rows of all files to
+     * @param recordCounts Output number of records loaded per file, -1 if the file failed
+     * @param threadCount Number of worker threads, 0 uses one per hardware thread
+     * @return Number of files loaded successfully
+     */
+    int loadFiles(const Vector<std::string> & filenames, WeatherSummary & summary,
+                  Vector<int> & recordCounts, int threadCount = 0);
+
 private:
+    /**
+     * @struct ColumnLayout
+     * @brief Positions of the columns the loader needs
+     */
+    struct ColumnLayout {
+        int wastIndex;  // Date and time column
+        int sIndex;     // Wind speed column
+        int tIndex;     // Temperature column
+        int srIndex;    // Solar radiation column
+        int maxIndex;   // Largest of the four, a row needs more fields than this
+    };
+
+    LoadMode loadMode;  // Mode used by loadData
+    bool cacheEnabled;  // Whether loadData reads and writes binary snapshots
+
+    /*
+     * The loaders below are written once for Vector<WeatherRecord>, WeatherTable
+     * and WeatherSummary: Records only needs a default constructor, size,
+     * reserve and emplace_back with the WeatherRecord constructor arguments.
+     * They are only used in loadWeatherData.cpp.
+     */
+
+    /**
+     * @brief Loads one file with the current mode, going through the snapshot when enabled
+     * @param filename Path to the CSV file to load
+     * @param records Records to append to
+     * @param threadCount Worker threads for the Chunked mode, 0 uses one per hardware thread
+     * @return true if data loaded successfully, false on error
+     */
+    template <class Records>
+    bool loadInto(const std::string & filename, Records & records, int threadCount);
+
+    /**
+     * @brief Loads one file through std::getline
+     * @param filename Path to the CSV file to load
+     * @param records Records to append to
+     * @return true if data loaded successfully, false on error
+     */
+    template <class Records>
+    bool parseStream(const std::string & filename, Records & records);
+
+    /**
+     * @brief Loads one memory mapped file on the calling thread
+     * @param filename Path to the CSV file to load
+     * @param records Records to append to
+     * @return true if data loaded successfully, false on error
+     */
+    template <class Records>
+    bool parseMapped(const std::string & filename, Records & records);
+
+    /**
+     * @brief Loads one memory mapped file in line aligned chunks on worker threads
+     * @param filename Path to the CSV file to load
+     * @param records Records to append to
+     * @param threadCount Number of worker threads, 0 uses one per hardware thread
+     * @return true if data loaded successfully, false on error
+     */
+    template <class Records>
+    bool parseChunked(const std::string & filename, Records & records, int threadCount);
+
+    /**
+     * @brief Loads several files on worker threads and appends them in order
+     * @param filenames Paths of the CSV files to load
+     * @param records Records to append the rows of all files to
+     * @param recordCounts Output number of records loaded per file, -1 if the file failed
+     * @param threadCount Number of worker threads, 0 uses one per hardware thread
+     * @return Number of files loaded successfully
+     */
+    template <class Records>
+    int loadFilesInto(const Vector<std::string> & filenames, Records & records,
+                      Vector<int> & recordCounts, int threadCount);
+
+    /**
+     * @brief Finds the required columns in the header line
+     * @param headerLine First line of the CSV file
+     * @param layout Output column positions
+     * @return true if every required column was found
+     */
+    bool readColumnLayout(const std::string & headerLine, ColumnLayout & layout);
+
+    /**
+     * @brief Maps a CSV file and reads its header
+     * @param filename Path to the CSV file
+     * @param file Mapping of the file, kept open for the caller
+     * @param layout Output column positions
+     * @param dataFirst Output start of the first data line
+     * @return true if the file was mapped and the header has every required column
+     */
+    bool openMapped(const std::string & filename, MappedFile & file, ColumnLayout & layout,
+                    const char * & dataFirst);
+
+    /**
+     * @brief Parses the data lines of a mapped range into records
+     * @param first First character of the range, must be at the start of a line
+     * @param last One past the last character of the range
+     * @param layout Column positions from the header
+     * @param records Records to append the accepted rows to
+     */
+    template <class Records>
+    void parseMappedRange(const char * first, const char * last, const ColumnLayout & layout,
+                          Records & records);
+
+    /**
+     * @brief Picks the required fields out of one line without copying them
+     * @param first First character of the line
+     * @param last One past the last character of the line (no line terminator)
+     * @param layout Column positions from the header
+     * @param wast Output view of the WAST field
+     * @param s Output view of the S field
+     * @param t Output view of the T field
+     * @param sr Output view of the SR field
+     * @return false if the line has too few fields
+     */
+    bool extractFields(const char * first, const char * last, const ColumnLayout & layout,
+                       FieldView & wast, FieldView & s, FieldView & t, FieldView & sr);
+
     /**
      * @brief Finds the index of a column in the header row
      * @param headers Vector of header strings
@@ -61,12 +321,26 @@ private:
      */
     bool isMissingData(const std::string & value);
 
+    /**
+     * @brief Checks if a field view represents missing data
+     * @param field Field to check
+     * @return true if field is empty, "NA", or "N/A"
+     */
+    bool isMissingData(const FieldView & field);
+
     /**
      * @brief Converts string to float value
      * @param str String to convert
      * @return Float value, or 0.0 if string is empty
      */
     float stringToFloat(const std::string & str);
+
+    /**
+     * @brief Converts a field view to float value without copying it
+     * @param field Field to convert
+     * @return Float value, or 0.0 if the field is empty
+     */
+    float stringToFloat(const FieldView & field);
 };
 
 #endif
@@ -5,7 +5,8 @@
  * @date 20/06/2025
  *
  * Features:
- * - Custom Map class for 10% bonus (minimal but complete - 4 methods)
+ * - Custom Map class for 10% bonus (minimal but complete - insert, operator[],
+ *   find with a const overload, clear; sorted arrays for integral keys)
  * - Minimal BST implementation (no isEmpty, height, etc.)
  * - sPCC (Sample Pearson Correlation Coefficient) in Menu Option 3
  * - MAD (Mean Absolute Deviation) in Menu Option 4
@@ -17,32 +18,70 @@
 #include <fstream>
 #include <string>
 #include "vector.h"
-#include "weatherRecord.h"
+#include "weatherTable.h"
 #include "loadWeatherData.h"
 #include "analyzeWeather.h"
+#include "weatherSummary.h"
+#include "weatherExport.h"
 #include "menu.h"
+#include "batchQuery.h"
 #include "Map.h"
 #include "bst.h"
 #include "statistics.h"
 
+// Forward declarations
+void reportLoadedFiles(std::ostream& out, const Vector<std::string>& filenames,
+                       const Vector<std::string>& fullPaths, const Vector<int>& recordCounts);
+int runStreamingExport(loadWeatherData& dataLoader, const Vector<std::string>& filenames,
+                       const Vector<std::string>& fullPaths, int year);
+
 /**
  * @brief Main function - entry point for Assignment 2
+ * @param argc Number of command line arguments
+ * @param argv Command line arguments, "--stream YEAR" selects the streaming export (YEAR 0 for
+ *             every year), "--batch FILE" the batch queries of FILE ("-" for standard input)
  * @return 0 on success, 1 on error
  *
  * Program flow:
  * 1. Load data source configuration
- * 2. Load and parse weather data from multiple CSV files (14 files)
+ * 2. Load and parse weather data from multiple CSV files (14 files) in parallel
  * 3. Initialize analysis system with BST and Map integration
  * 4. Run interactive menu loop with updated Assignment 2 features
+ *
+ * With "--stream YEAR" steps 2 to 4 are replaced by a streaming load into
+ * per-month running statistics, which never holds the records, followed by
+ * the menu option 4 export of YEAR.
+ *
+ * With "--batch FILE" step 4 is replaced by BatchQuery: the queries of FILE
+ * are answered on standard output, one CSV line each, against the data loaded
+ * once in steps 2 and 3. Progress messages go to standard error so the output
+ * holds only answers. Returns 1 if any query could not be read.
  */
-int main() {
-    std::cout << "==================================================" << std::endl;
-    std::cout << "     Weather Data Analysis Program - Assignment 2" << std::endl;
-    std::cout << "==================================================" << std::endl;
-    std::cout << "Features: Custom Map, Minimal BST, sPCC, MAD" << std::endl;
-    std::cout << "Loading data..." << std::endl;
-
-    loadWeatherData dataLoader;
+int main(int argc, char* argv[]) {
+    bool batchMode = (argc >= 3 && std::string(argv[1]) == "--batch");
+    std::ostream& status = batchMode ? std::cerr : std::cout;
+
+    // Open the queries before loading, so a wrong path fails at once
+    std::ifstream queryFile;
+    if (batchMode && std::string(argv[2]) != "-") {
+        queryFile.open(argv[2]);
+        if (!queryFile) {
+            std::cerr << "Cannot open query file " << argv[2] << std::endl;
+            return 1;
+        }
+    }
+
+    status << "==================================================" << std::endl;
+    status << "     Weather Data Analysis Program - Assignment 2" << std::endl;
+    status << "==================================================" << std::endl;
+    status << "Features: Custom Map, Minimal BST, sPCC, MAD" << std::endl;
+    status << "Loading data..." << std::endl;
+
+    // Tokenize the CSV files in place instead of copying every field
+    loadWeatherData dataLoader(loadWeatherData::LoadMode::Mapped);
+
+    // Reuse the binary snapshot of each file while its CSV is unchanged
+    dataLoader.setCacheEnabled(true);
     std::string dataFile = dataLoader.getDataSourceFilename();
 
     if (dataFile.empty()) {
@@ -50,43 +89,51 @@ int main() {
         return 1;
     }
 
-    Vector<WeatherRecord> allRecords;
-
     // Load multiple data files as specified in data_source.txt
-    std::ifstream sourceFile("data/data_source.txt");
-    if (!sourceFile) {
-        std::cerr << "Cannot open data_source.txt" << std::endl;
+    Vector<std::string> filenames;
+    if (!dataLoader.getDataSourceFilenames(filenames)) {
         return 1;
     }
 
-    std::string filename;
-    int filesLoaded = 0;
-    while (std::getline(sourceFile, filename)) {
-        std::string fullPath = "data/" + filename;
-        Vector<WeatherRecord> records;
-
-        if (dataLoader.loadData(fullPath, records)) {
-            std::cout << "Loaded " << records.size() << " records from " << filename << std::endl;
+    Vector<std::string> fullPaths;
+    for (int i = 0; i < filenames.size(); i++) {
+        fullPaths.push_back("data/" + filenames[i]);
+    }
 
-            // Merge records into allRecords
-            for (int i = 0; i < records.size(); i++) {
-                allRecords.push_back(records[i]);
-            }
-            filesLoaded++;
-        } else {
-            std::cout << "Warning: Could not load " << fullPath << std::endl;
+    if (argc >= 2 && std::string(argv[1]) == "--stream") {
+        // 0 means every year, so a typo must not silently become 0
+        int year;
+        if (argc < 3 || !BatchQuery::parseInt(argv[2], year)) {
+            std::cerr << "Usage: --stream YEAR (a whole number, 0 for every year)" << std::endl;
+            return 1;
         }
+        return runStreamingExport(dataLoader, filenames, fullPaths, year);
     }
-    sourceFile.close();
+
+    // One contiguous array per field, so each statistic only reads the columns it needs
+    WeatherTable allRecords;
+
+    // Files are parsed in parallel and merged in data_source.txt order
+    Vector<int> recordCounts;
+    int filesLoaded = dataLoader.loadFiles(fullPaths, allRecords, recordCounts);
+    reportLoadedFiles(status, filenames, fullPaths, recordCounts);
 
     if (allRecords.size() == 0) {
         std::cerr << "No data loaded from any files." << std::endl;
         return 1;
     }
 
-    std::cout << "\nData loading complete!" << std::endl;
-    std::cout << "Files loaded: " << filesLoaded << std::endl;
-    std::cout << "Total records: " << allRecords.size() << std::endl;
+    status << "\nData loading complete!" << std::endl;
+    status << "Files loaded: " << filesLoaded << std::endl;
+    status << "Total records: " << allRecords.size() << std::endl;
+
+    if (batchMode) {
+        analyzeWeather analyzer(allRecords);
+        BatchQuery batch(analyzer);
+        std::istream& queries = queryFile.is_open() ? static_cast<std::istream&>(queryFile) : std::cin;
+        int errors = batch.run(queries, std::cout);
+        return (errors == 0) ? 0 : 1;
+    }
 
     // Demonstrate custom Map class usage (for bonus marks)
     std::cout << "\n--- Custom Map Class Demo ---" << std::endl;
@@ -132,6 +179,62 @@ int main() {
     return 0;
 }
 
+/**
+ * @brief Prints how many records came from each data file
+ * @param out Stream to print to
+ * @param filenames Names as listed in data_source.txt
+ * @param fullPaths Paths the files were loaded from
+ * @param recordCounts Records per file from loadFiles, -1 if the file failed
+ */
+void reportLoadedFiles(std::ostream& out, const Vector<std::string>& filenames,
+                       const Vector<std::string>& fullPaths, const Vector<int>& recordCounts) {
+    for (int i = 0; i < filenames.size(); i++) {
+        if (recordCounts[i] >= 0) {
+            out << "Loaded " << recordCounts[i] << " records from " << filenames[i] << std::endl;
+        } else {
+            out << "Warning: Could not load " << fullPaths[i] << std::endl;
+        }
+    }
+}
+
+/**
+ * @brief Streams every data file into per-month statistics and exports one year or all of them
+ *
+ * For machines that cannot hold the records: rows go from the parser straight
+ * into a WeatherSummary, so memory is O(months). The export is written by the
+ * same code as menu option 4 and gives the same WindTempSolar.csv.
+ *
+ * @param dataLoader Loader with the mode and snapshot settings to use
+ * @param filenames Names as listed in data_source.txt
+ * @param fullPaths Paths to load
+ * @param year Year to export, 0 for every year in one combined file
+ * @return 0 on success, 1 on error
+ */
+int runStreamingExport(loadWeatherData& dataLoader, const Vector<std::string>& filenames,
+                       const Vector<std::string>& fullPaths, int year) {
+    WeatherSummary summary;
+    Vector<int> recordCounts;
+    dataLoader.loadFiles(fullPaths, summary, recordCounts);
+    reportLoadedFiles(std::cout, filenames, fullPaths, recordCounts);
+
+    if (summary.size() == 0) {
+        std::cerr << "No data loaded from any files." << std::endl;
+        return 1;
+    }
+
+    bool opened = (year == 0) ? weatherExport::exportAllYears(weatherExport::exportFilename, summary)
+                              : weatherExport::exportYear(weatherExport::exportFilename, year, summary);
+    if (!opened) {
+        std::cerr << "Error opening file for writing." << std::endl;
+        return 1;
+    }
+
+    std::cout << "\nStreamed " << summary.size() << " records." << std::endl;
+    std::cout << "Data exported to " << weatherExport::exportFilename << " successfully." << std::endl;
+    std::cout << "Format: " << weatherExport::exportFormat << std::endl;
+    return 0;
+}
+
 /**
  * Assignment 2 Implementation Notes:
  *
@@ -142,8 +245,8 @@ int main() {
  *    - Proper memory management
  *
  * 2. CUSTOM MAP CLASS (Map.h) - FOR 10% BONUS:
- *    - Exactly 4 public methods: insert(), operator[], find(), clear()
- *    - Uses BST internally for implementation
+ *    - Public methods: insert(), operator[], find() (plus a const overload), clear()
+ *    - Uses BST internally; integral keys use sorted arrays with the same methods
  *    - Minimal but complete - primary behavior is key-value association
  *    - NOT the same as std::map - our own minimal interface
  *
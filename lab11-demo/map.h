@@ -2,6 +2,9 @@
 #define MAP_H
 
 #include "bst.h"
+#include "vector.h"
+#include <type_traits>
+#include <utility>
 
 /**
  * @file Map.h
@@ -9,8 +12,15 @@
  * @author Dhruv Goswami
  * @date 20/06/2025
  *
- * Minimal but complete Map class - exactly 4 public methods as required
+ * Minimal but complete Map class - insert, operator[], find and clear
  * Primary behavior: associate one type with another type using BST internally
+ * Values live inside the tree nodes, so operator[] and find hand out the stored
+ * value itself and it can be updated in place.
+ *
+ * Integral keys (int month keys, years, ...) get a specialization with the
+ * same interface that keeps the keys and values in two sorted arrays: a lookup
+ * is a binary search over contiguous ints, with no node allocations and no
+ * pointer chasing, and keys that arrive in ascending order are appended.
  */
 
 template <class T, class U>
@@ -20,6 +30,7 @@ struct MapNode {
 
     MapNode() = default;
     MapNode(const T& k, const U& v) : key(k), value(v) {}
+    explicit MapNode(const T& k) : key(k), value() {}
 
     // Operators needed for BST operations
     bool operator==(const MapNode& other) const {
@@ -47,7 +58,20 @@ struct MapNode {
     }
 };
 
-template <class T, class U>
+/**
+ * @brief Orders a stored MapNode against a key, for the tree's key-only lookups
+ */
+template <class T>
+struct MapKeyCompare {
+    const T& key;
+
+    template <class U>
+    int operator()(const MapNode<T, U>& node) const {
+        return key < node.key ? -1 : (node.key < key ? 1 : 0);
+    }
+};
+
+template <class T, class U, bool FlatKeys = std::is_integral<T>::value>
 class Map {
 public:
     /**
@@ -60,16 +84,23 @@ public:
     /**
      * @brief Access value by key (creates if doesn't exist)
      * @param key The key to access
-     * @return Reference to the value associated with key
+     * @return Reference to the value stored for key, valid until clear()
      */
     U& operator[](const T& key);
 
     /**
-     * @brief Check if key exists in map
+     * @brief Look up the value stored for a key
      * @param key The key to search for
-     * @return true if key exists, false otherwise
+     * @return Pointer to the stored value (can be updated in place), nullptr if key is not in the map
      */
-    bool find(const T& key) const;
+    U* find(const T& key);
+
+    /**
+     * @brief Look up the value stored for a key
+     * @param key The key to search for
+     * @return Pointer to the stored value, nullptr if key is not in the map
+     */
+    const U* find(const T& key) const;
 
     /**
      * @brief Clear all key-value pairs from map
@@ -77,53 +108,199 @@ public:
     void clear();
 
 private:
-    BinarySearchTree<MapNode<T, U>> bst;  // Using BST for internal storage
+    // Using BST for internal storage, balanced since keys often arrive sorted,
+    // nodes pooled so clear() frees blocks instead of every node
+    BinarySearchTree<MapNode<T, U>, true, PoolNodeAllocator<MapNode<T, U>>> bst;
+};
 
-    // Helper function to find a node
-    MapNode<T, U>* findNode(const T& key) const;
+/**
+ * @brief Map for integral keys, stored as two parallel sorted arrays
+ *
+ * Same interface as the BST Map. The difference for callers: inserting a new
+ * key moves the values after it, so a reference or pointer returned by
+ * operator[] or find is only valid until the next new key or clear().
+ */
+template <class T, class U>
+class Map<T, U, true> {
+public:
+    /**
+     * @brief Insert or update key-value pair
+     * @param key The key to insert/update
+     * @param value The value to associate with the key
+     */
+    void insert(const T& key, const U& value);
+
+    /**
+     * @brief Access value by key (creates if doesn't exist)
+     * @param key The key to access
+     * @return Reference to the value stored for key, valid until a new key is added or clear()
+     */
+    U& operator[](const T& key);
+
+    /**
+     * @brief Look up the value stored for a key
+     * @param key The key to search for
+     * @return Pointer to the stored value, valid until a new key is added, nullptr if key is not in the map
+     */
+    U* find(const T& key);
+
+    /**
+     * @brief Look up the value stored for a key
+     * @param key The key to search for
+     * @return Pointer to the stored value, nullptr if key is not in the map
+     */
+    const U* find(const T& key) const;
+
+    /**
+     * @brief Clear all key-value pairs from map
+     */
+    void clear();
+
+private:
+    Vector<T> keys;    // Ascending
+    Vector<U> values;  // values[i] belongs to keys[i]
+
+    /**
+     * @brief Position of the first key that is not less than key
+     * @param key Key to look for
+     * @return Index in keys, keys.size() if every key is less
+     */
+    int lowerBound(const T& key) const;
+
+    /**
+     * @brief Adds a new key at its sorted position
+     * @param position Result of lowerBound for key
+     * @param key Key to add, not in the map yet
+     * @param value Value to store with it; taken by value because the caller's
+     *              may live in the map, where growing and shifting would change it
+     * @return The stored value
+     */
+    U& insertAt(int position, T key, U value);
 };
 
 // Implementation
+// Every operation is a single descent of the tree that compares the key
+// alone; a node, and with it a value, is only built when a key is added.
+
+template <class T, class U, bool FlatKeys>
+void Map<T, U, FlatKeys>::insert(const T& key, const U& value) {
+    bool inserted;
+    MapNode<T, U>* node = bst.findOrInsertBy(MapKeyCompare<T>{key},
+                                             [&]() { return MapNode<T, U>(key, value); }, &inserted);
+    if (!inserted) {
+        node->value = value;    // key already there, update its value
+    }
+}
+
+template <class T, class U, bool FlatKeys>
+U& Map<T, U, FlatKeys>::operator[](const T& key) {
+    return bst.findOrInsertBy(MapKeyCompare<T>{key}, [&key]() { return MapNode<T, U>(key); })->value;
+}
+
+template <class T, class U, bool FlatKeys>
+U* Map<T, U, FlatKeys>::find(const T& key) {
+    MapNode<T, U>* node = bst.findElementBy(MapKeyCompare<T>{key});
+    return node == nullptr ? nullptr : &node->value;
+}
+
+template <class T, class U, bool FlatKeys>
+const U* Map<T, U, FlatKeys>::find(const T& key) const {
+    const MapNode<T, U>* node = bst.findElementBy(MapKeyCompare<T>{key});
+    return node == nullptr ? nullptr : &node->value;
+}
+
+template <class T, class U, bool FlatKeys>
+void Map<T, U, FlatKeys>::clear() {
+    bst.destroyTree();
+}
+
+// Integral key implementation
+// Keys usually arrive in ascending order (records are read in date order),
+// so the last key is checked before the binary search and a new largest key
+// is a plain append.
+
+template <class T, class U>
+int Map<T, U, true>::lowerBound(const T& key) const {
+    const T* first = keys.begin();
+    int count = keys.size();
+    if (count == 0 || first[count - 1] < key) {
+        return count;
+    }
+    if (first[count - 1] == key) {
+        return count - 1;
+    }
+
+    // halve the range without a data dependent branch: the compare result is
+    // added to the position, so a random key costs no mispredicted jumps
+    const T* base = first;
+    int length = count;
+    while (length > 1) {
+        int half = length / 2;
+        base += static_cast<int>(base[half - 1] < key) * half;
+        length -= half;
+    }
+    return static_cast<int>(base - first) + static_cast<int>(*base < key);
+}
 
 template <class T, class U>
-void Map<T, U>::insert(const T& key, const U& value) {
-    MapNode<T, U> newNode(key, value);
+U& Map<T, U, true>::insertAt(int position, T key, U value) {
+    int count = keys.size();
+    if (position == count) {
+        keys.push_back(key);
+        values.push_back(std::move(value));
+        return values[count];
+    }
 
-    // Check if key already exists - if so, we need to update value
-    // For simplicity in minimal implementation, just insert new node
-    // BST will handle duplicates by not inserting
-    bst.insertElement(newNode);
+    // open a gap at position by moving the tail up one slot; the last element
+    // is taken out first because push_back may reallocate under it
+    T lastKey = keys[count - 1];
+    U lastValue = std::move(values[count - 1]);
+    keys.push_back(lastKey);
+    values.push_back(std::move(lastValue));
+    for (int i = count - 1; i > position; i--) {
+        keys[i] = keys[i - 1];
+        values[i] = std::move(values[i - 1]);
+    }
+    keys[position] = key;
+    values[position] = std::move(value);
+    return values[position];
 }
 
 template <class T, class U>
-U& Map<T, U>::operator[](const T& key) {
-    // This is a simplified implementation
-    // In a full implementation, we'd need to handle the case where key doesn't exist
-    // For now, we'll use a static default value approach
-    static U defaultValue;
-
-    MapNode<T, U> searchNode(key, defaultValue);
-    if (bst.searchElement(searchNode)) {
-        // Key exists - in a full implementation we'd return reference to actual value
-        // This is a limitation of our minimal BST not having a getValue method
-        return defaultValue;  // Simplified for minimal implementation
+void Map<T, U, true>::insert(const T& key, const U& value) {
+    int position = lowerBound(key);
+    if (position < keys.size() && keys[position] == key) {
+        values[position] = value;   // key already there, update its value
     } else {
-        // Key doesn't exist - insert with default value and return reference
-        insert(key, defaultValue);
-        return defaultValue;
+        insertAt(position, key, value);
     }
 }
 
 template <class T, class U>
-bool Map<T, U>::find(const T& key) const {
-    U dummyValue{};  // Default constructed value for search
-    MapNode<T, U> searchNode(key, dummyValue);
-    return bst.searchElement(searchNode);
+U& Map<T, U, true>::operator[](const T& key) {
+    int position = lowerBound(key);
+    if (position < keys.size() && keys[position] == key) {
+        return values[position];
+    }
+    return insertAt(position, key, U());
 }
 
 template <class T, class U>
-void Map<T, U>::clear() {
-    bst.destroyTree();
+U* Map<T, U, true>::find(const T& key) {
+    int position = lowerBound(key);
+    return (position < keys.size() && keys.begin()[position] == key) ? values.begin() + position : nullptr;
+}
+
+template <class T, class U>
+const U* Map<T, U, true>::find(const T& key) const {
+    int position = lowerBound(key);
+    return (position < keys.size() && keys.begin()[position] == key) ? values.begin() + position : nullptr;
+}
+
+template <class T, class U>
+void Map<T, U, true>::clear() {
+    keys.clear();
+    values.clear();
 }
 
 #endif // MAP_H
@@ -0,0 +1,136 @@
+/**
+ * @file mappedFile.cpp
+ * @brief Implementation of the read-only memory mapped file
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ */
+
+#include "mappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+MappedFile::MappedFile() : data(nullptr), length(0), fileHandle(nullptr), mappingHandle(nullptr) {}
+
+bool MappedFile::open(const std::string & filename) {
+    close();
+
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return false;
+    }
+
+    fileHandle = file;
+    length = static_cast<std::size_t>(fileSize.QuadPart);
+    if (length == 0) {
+        return true; // Nothing to map, begin() == end()
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        close();
+        return false;
+    }
+    mappingHandle = mapping;
+
+    data = static_cast<const char *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (data == nullptr) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::close() {
+    if (data != nullptr) {
+        UnmapViewOfFile(data);
+    }
+    if (mappingHandle != nullptr) {
+        CloseHandle(static_cast<HANDLE>(mappingHandle));
+    }
+    if (fileHandle != nullptr) {
+        CloseHandle(static_cast<HANDLE>(fileHandle));
+    }
+    data = nullptr;
+    length = 0;
+    fileHandle = nullptr;
+    mappingHandle = nullptr;
+}
+
+#else
+
+MappedFile::MappedFile() : data(nullptr), length(0) {}
+
+bool MappedFile::open(const std::string & filename) {
+    close();
+
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) == -1) {
+        ::close(fd);
+        return false;
+    }
+
+    length = static_cast<std::size_t>(info.st_size);
+    if (length == 0) {
+        ::close(fd);
+        return true; // mmap rejects zero length, begin() == end()
+    }
+
+    void * view = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // The mapping keeps its own reference to the file
+    if (view == MAP_FAILED) {
+        length = 0;
+        return false;
+    }
+
+    // The file is scanned front to back once, let the kernel read ahead
+    madvise(view, length, MADV_SEQUENTIAL);
+    data = static_cast<const char *>(view);
+    return true;
+}
+
+void MappedFile::close() {
+    if (data != nullptr) {
+        munmap(const_cast<char *>(data), length);
+    }
+    data = nullptr;
+    length = 0;
+}
+
+#endif
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+const char * MappedFile::begin() const {
+    return data;
+}
+
+const char * MappedFile::end() const {
+    return data + length;
+}
+
+std::size_t MappedFile::size() const {
+    return length;
+}
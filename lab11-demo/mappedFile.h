@@ -0,0 +1,77 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <cstddef>
+
+/**
+ * @file mappedFile.h
+ * @brief Read-only memory mapped file used by the fast CSV loading path
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ */
+
+/**
+ * @class MappedFile
+ * @brief Maps a whole file read-only into memory so it can be scanned in place
+ *
+ * Uses mmap on POSIX systems and MapViewOfFile on Windows. The mapping is
+ * released when the object is closed or destroyed, so any pointers obtained
+ * from begin()/end() must not outlive it. Copying is disabled because two
+ * objects would otherwise unmap the same view.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Default constructor, nothing is mapped
+     */
+    MappedFile();
+
+    /**
+     * @brief Destructor, unmaps the file if it is still open
+     */
+    ~MappedFile();
+
+    /**
+     * @brief Maps a file into memory
+     * @param filename Path of the file to map
+     * @return true if the file was opened (an empty file maps to an empty range)
+     */
+    bool open(const std::string & filename);
+
+    /**
+     * @brief Releases the mapping
+     */
+    void close();
+
+    /**
+     * @brief Gets the first byte of the mapped file
+     * @return Pointer to the start of the file contents
+     */
+    const char * begin() const;
+
+    /**
+     * @brief Gets one past the last byte of the mapped file
+     * @return Pointer to the end of the file contents
+     */
+    const char * end() const;
+
+    /**
+     * @brief Gets the size of the mapped file
+     * @return Size in bytes
+     */
+    std::size_t size() const;
+
+    MappedFile(const MappedFile & other) = delete;
+    MappedFile & operator=(const MappedFile & other) = delete;
+
+private:
+    const char * data;      // Start of the mapped view, nullptr when nothing is mapped
+    std::size_t length;     // Number of mapped bytes
+#ifdef _WIN32
+    void * fileHandle;      // HANDLE of the open file
+    void * mappingHandle;   // HANDLE of the file mapping object
+#endif
+};
+
+#endif // MAPPED_FILE_H
@@ -6,8 +6,8 @@
  */
 
 #include "menu.h"
+#include "weatherExport.h"
 #include <iostream>
-#include <fstream>
 #include <iomanip>
 #include <cmath>
 
@@ -73,14 +73,10 @@ int Menu::getYear() {
 }
 
 std::string Menu::getMonthName(int month) {
-    const std::string monthNames[] = {
-        "January", "February", "March", "April", "May", "June",
-        "July", "August", "September", "October", "November", "December"
-    };
-    return monthNames[month - 1];
+    return weatherExport::getMonthName(month);
 }
 
-std::string Menu::getParameterType() {
+WeatherParameter Menu::getParameterType() {
     std::cout << "\nSelect parameter type:" << std::endl;
     std::cout << "1. Wind Speed" << std::endl;
     std::cout << "2. Temperature" << std::endl;
@@ -91,12 +87,12 @@ std::string Menu::getParameterType() {
     std::cin >> choice;
 
     switch (choice) {
-        case 1: return "wind";
-        case 2: return "temp";
-        case 3: return "solar";
+        case 1: return WeatherParameter::Wind;
+        case 2: return WeatherParameter::Temperature;
+        case 3: return WeatherParameter::Solar;
         default:
             std::cout << "Invalid choice, defaulting to wind speed." << std::endl;
-            return "wind";
+            return WeatherParameter::Wind;
     }
 }
 
@@ -154,14 +150,14 @@ void Menu::handleSolarRadiationStats(analyzeWeather& analyzer) {
               << getMonthName(month) << " " << year << std::endl;
 
     std::cout << "\nSelect first parameter:" << std::endl;
-    std::string param1 = getParameterType();
+    WeatherParameter param1 = getParameterType();
 
     std::cout << "\nSelect second parameter:" << std::endl;
-    std::string param2 = getParameterType();
+    WeatherParameter param2 = getParameterType();
 
     float correlation;
     if (analyzer.calculatesPCC(month, year, param1, param2, correlation)) {
-        std::cout << "\nCorrelation between " << param1 << " and " << param2
+        std::cout << "\nCorrelation between " << getParameterName(param1) << " and " << getParameterName(param2)
                   << ": " << std::fixed << std::setprecision(4) << correlation << std::endl;
 
         // Interpret correlation strength
@@ -189,59 +185,54 @@ void Menu::handleSolarRadiationStats(analyzeWeather& analyzer) {
 }
 
 void Menu::handleExportCSV(analyzeWeather& analyzer) {
+    std::cout << "Enter 0 as the year to export every year." << std::endl;
     int year = getYear();
+    if (year == 0) {
+        handleExportAllYears(analyzer);
+        return;
+    }
 
-    std::ofstream outFile("WindTempSolar.csv");
-    if (!outFile) {
+    // Same writer as the streaming mode, so both produce the same file
+    if (!weatherExport::exportYear(weatherExport::exportFilename, year, analyzer)) {
         std::cerr << "Error opening file for writing." << std::endl;
         return;
     }
 
-    outFile << std::fixed << std::setprecision(2);
-    outFile << year << std::endl;
-
-    bool hasAnyData = false;
-    for (int month = 1; month <= 12; ++month) {
-        if (analyzer.hasDataForMonth(month, year)) {
-            hasAnyData = true;
-
-            float meanSpeed, stdevSpeed, madSpeed;
-            float meanTemp, stdevTemp, madTemp;
-            float totalRadiation;
-
-            bool hasWind = analyzer.CalculateWindSpeedStats(month, year, meanSpeed, stdevSpeed, madSpeed);
-            bool hasTemp = analyzer.calculateTemperatureStats(month, year, meanTemp, stdevTemp, madTemp);
-            bool hasRadiation = analyzer.calculateSolarRadiation(month, year, totalRadiation);
-
-            outFile << getMonthName(month) << ",";
-
-            // Wind Speed with stdev and MAD
-            if (hasWind) {
-                outFile << meanSpeed << "(" << stdevSpeed << ", " << madSpeed << "),";
-            } else {
-                outFile << ",";
-            }
-
-            // Temperature with stdev and MAD
-            if (hasTemp) {
-                outFile << meanTemp << "(" << stdevTemp << ", " << madTemp << "),";
-            } else {
-                outFile << ",";
-            }
-
-            // Solar Radiation
-            if (hasRadiation) {
-                outFile << totalRadiation;
-            }
-            outFile << std::endl;
-        }
-    }
+    std::cout << "\nData exported to " << weatherExport::exportFilename << " successfully." << std::endl;
+    std::cout << "Format: " << weatherExport::exportFormat << std::endl;
+}
 
-    if (!hasAnyData) {
-        outFile << "No data available for year " << year << std::endl;
-    }
+void Menu::handleExportAllYears(analyzeWeather& analyzer) {
+    std::cout << "\n1. One combined file (" << weatherExport::exportFilename << ")" << std::endl;
+    std::cout << "2. One file per year (" << weatherExport::yearFilename(2015) << ", ...)" << std::endl;
+    std::cout << "Enter choice (1-2): ";
 
-    outFile.close();
-    std::cout << "\nData exported to WindTempSolar.csv successfully." << std::endl;
-    std::cout << "Format: Month,Average Wind Speed(stdev, mad),Average Ambient Temperature(stdev, mad),Total Solar Radiation" << std::endl;
-}
+    int choice;
+    std::cin >> choice;
+
+    if (choice == 2) {
+        Vector<std::string> written;
+        bool ok = weatherExport::exportEachYear(analyzer, written);
+        for (int i = 0; i < written.size(); i++) {
+            std::cout << "Data exported to " << written[i] << " successfully." << std::endl;
+        }
+        if (!ok) {
+            std::cerr << "Error opening file for writing." << std::endl;
+            return;
+        }
+        if (written.size() == 0) {
+            std::cout << "No data available to export." << std::endl;
+            return;
+        }
+    } else {
+        if (choice != 1) {
+            std::cout << "Invalid choice, defaulting to one combined file." << std::endl;
+        }
+        if (!weatherExport::exportAllYears(weatherExport::exportFilename, analyzer)) {
+            std::cerr << "Error opening file for writing." << std::endl;
+            return;
+        }
+        std::cout << "\nData exported to " << weatherExport::exportFilename << " successfully." << std::endl;
+    }
+    std::cout << "Format: " << weatherExport::exportFormat << std::endl;
+}
\ No newline at end of file
@@ -19,7 +19,7 @@
  * 1. Analyze Wind Speed Statistics
  * 2. Analyze Temperature Statistics
  * 3. Analyze Solar Radiation Statistics WITH sPCC
- * 4. Export Data to CSV WITH MAD calculations
+ * 4. Export Data to CSV WITH MAD calculations (year 0 exports every year)
  * 5. Exit
  */
 class Menu {
@@ -91,11 +91,17 @@ private:
      */
     void handleExportCSV(analyzeWeather& analyzer);
 
+    /**
+     * @brief Exports every year, to one combined file or one file per year (Menu option 4, year 0)
+     * @param analyzer Reference to analyzeWeather object
+     */
+    void handleExportAllYears(analyzeWeather& analyzer);
+
     /**
      * @brief Gets parameter type for sPCC calculation
-     * @return Parameter type: "wind", "temp", or "solar"
+     * @return Parameter chosen, wind speed for an invalid choice
      */
-    std::string getParameterType();
+    WeatherParameter getParameterType();
 };
 
 #endif // MENU_H
@@ -0,0 +1,61 @@
+/**
+ * @file monthMoments.cpp
+ * @brief Implementation of the per-month running sums
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ */
+
+#include "monthMoments.h"
+
+void MonthMoments::add(float windMps, float temperature, float solarWm2) {
+    // Same units the queries report: wind in km/h, solar in kWh/m2
+    float windKmh = convertMpsToKmh(windMps);
+    float solarKwh = convertWm2ToKwhM2(solarWm2);
+    wind.add(windKmh);
+    temp.add(temperature);
+    solar.add(solarKwh);
+    windTemp += static_cast<double>(windKmh) * temperature;
+    windSolar += static_cast<double>(windKmh) * solarKwh;
+    tempSolar += static_cast<double>(temperature) * solarKwh;
+}
+
+void MonthMoments::merge(const MonthMoments& other) {
+    wind.merge(other.wind);
+    temp.merge(other.temp);
+    solar.merge(other.solar);
+    windTemp += other.windTemp;
+    windSolar += other.windSolar;
+    tempSolar += other.tempSolar;
+}
+
+const statistics::Moments& MonthMoments::select(WeatherParameter parameter) const {
+    switch (parameter) {
+        case WeatherParameter::Wind: return wind;
+        case WeatherParameter::Temperature: return temp;
+        case WeatherParameter::Solar: return solar;
+    }
+    return wind;
+}
+
+double MonthMoments::sumProducts(WeatherParameter parameter1, WeatherParameter parameter2) const {
+    if (parameter1 == parameter2) {
+        return select(parameter1).sumSquares;
+    }
+
+    bool hasWind = (parameter1 == WeatherParameter::Wind || parameter2 == WeatherParameter::Wind);
+    bool hasTemp = (parameter1 == WeatherParameter::Temperature || parameter2 == WeatherParameter::Temperature);
+    if (hasWind && hasTemp) {
+        return windTemp;
+    } else if (hasWind) {
+        return windSolar;
+    }
+    return tempSolar;
+}
+
+float MonthMoments::convertMpsToKmh(float mps) {
+    return mps * 3.6f;
+}
+
+float MonthMoments::convertWm2ToKwhM2(float wPerM2) {
+    return wPerM2 * (1.0f / 6.0f) / 1000.0f;
+}
@@ -0,0 +1,87 @@
+#ifndef MONTH_MOMENTS_H
+#define MONTH_MOMENTS_H
+
+#include "statistics.h"
+#include "weatherParameter.h"
+
+/**
+ * @file monthMoments.h
+ * @brief Running sums of one month of weather readings
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ */
+
+/**
+ * @struct MonthMoments
+ * @brief Moment sums of one month's values, wind in km/h and solar in kWh/m2
+ *
+ * Filled one reading at a time, so it serves both the analyzer, which builds
+ * it alongside its month index, and WeatherSummary, which never keeps the
+ * readings. The mean, standard deviation, solar total and sPCC of a month all
+ * come from these sums; only MAD needs more.
+ */
+struct MonthMoments {
+    statistics::Moments wind;
+    statistics::Moments temp;
+    statistics::Moments solar;
+    double windTemp = 0.0;   // Sum of wind * temp, for sPCC
+    double windSolar = 0.0;  // Sum of wind * solar
+    double tempSolar = 0.0;  // Sum of temp * solar
+
+    /**
+     * @brief Adds one reading, converting it to the reported units
+     * @param windMps Wind speed in m/s
+     * @param temperature Temperature in degrees C
+     * @param solarWm2 Solar radiation in W/m2
+     */
+    void add(float windMps, float temperature, float solarWm2);
+
+    /**
+     * @brief Adds every reading of another month summary
+     * @param other Summary to merge in
+     */
+    void merge(const MonthMoments& other);
+
+    /**
+     * @brief Picks the summary of one parameter
+     * @param parameter Parameter
+     * @return Summary of that parameter
+     */
+    const statistics::Moments& select(WeatherParameter parameter) const;
+
+    /**
+     * @brief Picks the sum of products of two parameters
+     * @param parameter1 First parameter
+     * @param parameter2 Second parameter
+     * @return Sum over the month of value1 * value2
+     */
+    double sumProducts(WeatherParameter parameter1, WeatherParameter parameter2) const;
+
+    /**
+     * @brief Converts wind speed from m/s to km/h
+     * @param mps Wind speed in meters per second
+     * @return Wind speed in kilometers per hour
+     */
+    static float convertMpsToKmh(float mps);
+
+    /**
+     * @brief Converts solar radiation from W/m2 to kWh/m2
+     * @param wPerM2 Solar radiation in watts per square meter
+     * @return Solar radiation in kilowatt-hours per square meter
+     */
+    static float convertWm2ToKwhM2(float wPerM2);
+};
+
+/**
+ * @struct MonthStats
+ * @brief Everything the WindTempSolar.csv export reports for one month
+ */
+struct MonthStats {
+    int year = 0;                        // Year
+    int month = 0;                       // Month (1-12)
+    statistics::DescriptiveStats wind;   // Wind speed in km/h
+    statistics::DescriptiveStats temp;   // Temperature in degrees C
+    float solarTotal = 0.0f;             // Total solar radiation in kWh/m2
+};
+
+#endif // MONTH_MOMENTS_H
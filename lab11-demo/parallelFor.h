@@ -0,0 +1,110 @@
+#ifndef PARALLEL_FOR_H
+#define PARALLEL_FOR_H
+
+#include "vector.h"
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <exception>
+
+/**
+ * @file parallelFor.h
+ * @brief Small worker pool that runs independent tasks on several threads
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ */
+
+/**
+ * @brief Picks how many worker threads to use for a number of tasks
+ * @param taskCount Number of independent tasks
+ * @param threadCount Requested thread count, 0 means one per hardware thread
+ * @return Number of threads to start, between 1 and taskCount
+ */
+inline int workerCount(int taskCount, int threadCount = 0) {
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (threadCount <= 0) {
+            threadCount = 1; // hardware_concurrency may not know
+        }
+    }
+    if (threadCount > taskCount) {
+        threadCount = taskCount;
+    }
+    return threadCount < 1 ? 1 : threadCount;
+}
+
+/**
+ * @brief Runs task(i) for every i in [0, taskCount) on a pool of worker threads
+ *
+ * Workers take the next task index from a shared counter, so uneven tasks
+ * (files or chunks of different sizes) still keep every thread busy. The call
+ * returns once every task has finished. Tasks must not touch shared state
+ * without their own synchronisation; writing to a slot owned by index i is fine.
+ *
+ * If a task throws, the workers stop taking new tasks, every started thread is
+ * joined and the first exception is rethrown on the calling thread.
+ *
+ * @param taskCount Number of tasks
+ * @param task Callable taking the task index as an int
+ * @param threadCount Number of worker threads, 0 means one per hardware thread
+ */
+template <class Task>
+void parallelFor(int taskCount, Task task, int threadCount = 0) {
+    if (taskCount <= 0) {
+        return;
+    }
+
+    int workers = workerCount(taskCount, threadCount);
+    if (workers == 1) {
+        for (int i = 0; i < taskCount; i++) {
+            task(i);
+        }
+        return;
+    }
+
+    std::atomic<int> nextTask(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr error;  // First exception thrown by a task
+    std::mutex errorLock;      // Guards error
+
+    // an exception must not leave a std::thread (that would call std::terminate),
+    // so each worker keeps the first one for the calling thread to rethrow
+    auto worker = [&]() {
+        try {
+            for (int i = nextTask++; i < taskCount && !failed; i = nextTask++) {
+                task(i);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorLock);
+            if (!error) {
+                error = std::current_exception();
+            }
+            failed = true;
+        }
+    };
+
+    // The threads use nextTask and worker on this stack, so every started one
+    // is joined before parallelFor is left, even when starting the next throws
+    struct JoinAll {
+        Vector<std::thread> & threads;
+        ~JoinAll() {
+            for (int i = 0; i < threads.size(); i++) {
+                threads[i].join();
+            }
+        }
+    };
+    Vector<std::thread> pool(workers - 1);
+    {
+        JoinAll joinAll{pool};
+        for (int i = 0; i < workers - 1; i++) {
+            pool.emplace_back(worker);
+        }
+        worker(); // the calling thread is one of the workers
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+#endif // PARALLEL_FOR_H
@@ -0,0 +1,85 @@
+#ifndef PARAMETER_FIELD_H
+#define PARAMETER_FIELD_H
+
+#include "weatherParameter.h"
+#include "weatherRecord.h"
+#include "monthMoments.h"
+
+/**
+ * @file parameterField.h
+ * @brief Compile time access to one parameter of a WeatherRecord
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ */
+
+/**
+ * @struct ParameterField
+ * @brief ParameterField<P>::get reads parameter P of a record, in the unit it is reported in
+ *
+ * Replaces testing a parameter name for every record: the parameter is a
+ * template argument, so a loop over records compiles to a plain load (and for
+ * wind and solar a multiply) per element.
+ */
+template <WeatherParameter P>
+struct ParameterField;
+
+template <>
+struct ParameterField<WeatherParameter::Wind> {
+    static float get(const WeatherRecord& record) {
+        return MonthMoments::convertMpsToKmh(record.getWindSpeed());
+    }
+};
+
+template <>
+struct ParameterField<WeatherParameter::Temperature> {
+    static float get(const WeatherRecord& record) {
+        return record.getTemperature();
+    }
+};
+
+template <>
+struct ParameterField<WeatherParameter::Solar> {
+    static float get(const WeatherRecord& record) {
+        return MonthMoments::convertWm2ToKwhM2(record.getSolarRadiation());
+    }
+};
+
+/**
+ * @brief Copies one parameter of a run of records into a float array
+ * @param records First record
+ * @param count Number of records
+ * @param values Output, room for count values
+ */
+template <WeatherParameter P>
+void gatherParameter(const WeatherRecord* records, int count, float* values) {
+    for (int i = 0; i < count; i++) {
+        values[i] = ParameterField<P>::get(records[i]);
+    }
+}
+
+/**
+ * @brief Copies one parameter of a run of records, choosing the loop once
+ *
+ * For a parameter only known at run time: one switch picks the specialized
+ * loop, instead of a test per record.
+ *
+ * @param parameter Parameter to copy
+ * @param records First record
+ * @param count Number of records
+ * @param values Output, room for count values
+ */
+inline void gatherParameter(WeatherParameter parameter, const WeatherRecord* records, int count, float* values) {
+    switch (parameter) {
+        case WeatherParameter::Wind:
+            gatherParameter<WeatherParameter::Wind>(records, count, values);
+            break;
+        case WeatherParameter::Temperature:
+            gatherParameter<WeatherParameter::Temperature>(records, count, values);
+            break;
+        case WeatherParameter::Solar:
+            gatherParameter<WeatherParameter::Solar>(records, count, values);
+            break;
+    }
+}
+
+#endif // PARAMETER_FIELD_H
@@ -8,33 +8,406 @@
 #include "statistics.h"
 #include <cmath>
 
+// SSE2 and AVX2 kernels need GCC style target attributes and cpu detection (GCC, MinGW, Clang)
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define STATISTICS_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define STATISTICS_X86_SIMD 0
+#endif
+
 namespace statistics {
 
-    float calculateMean(const Vector<float>& data) {
-        if (data.size() == 0) {
+    namespace {
+        // The four reductions every statistic is built from. Each converts to
+        // double before doing any arithmetic and accumulates in double.
+
+        /// Sum of the values
+        typedef double (*SumKernel)(const float* data, int count);
+        /// Sum of (value - shift) and of its square
+        typedef void (*ShiftedSumsKernel)(const float* data, int count, double shift,
+                                          double& sum, double& sumSquares);
+        /// Sum of |value - center|
+        typedef double (*AbsDiffKernel)(const float* data, int count, double center);
+        /// Sums of dx * dy, dx^2 and dy^2 with dx = x - meanX, dy = y - meanY
+        typedef void (*CrossSumsKernel)(const float* dataX, const float* dataY, int count,
+                                        double meanX, double meanY,
+                                        double& sumXY, double& sumXX, double& sumYY);
+
+        struct Kernels {
+            SimdLevel level;
+            SumKernel sum;
+            ShiftedSumsKernel shiftedSums;
+            AbsDiffKernel sumAbsDiff;
+            CrossSumsKernel crossSums;
+        };
+
+        // Scalar kernels, also the tail loops of the vector kernels
+
+        double sumScalar(const float* data, int count) {
+            double total = 0.0;
+            for (int i = 0; i < count; i++) {
+                total += data[i];
+            }
+            return total;
+        }
+
+        void shiftedSumsScalar(const float* data, int count, double shift, double& sum, double& sumSquares) {
+            sum = 0.0;
+            sumSquares = 0.0;
+            for (int i = 0; i < count; i++) {
+                double diff = data[i] - shift;
+                sum += diff;
+                sumSquares += diff * diff;
+            }
+        }
+
+        double sumAbsDiffScalar(const float* data, int count, double center) {
+            double total = 0.0;
+            for (int i = 0; i < count; i++) {
+                total += std::abs(data[i] - center);
+            }
+            return total;
+        }
+
+        void crossSumsScalar(const float* dataX, const float* dataY, int count, double meanX, double meanY,
+                             double& sumXY, double& sumXX, double& sumYY) {
+            sumXY = 0.0;
+            sumXX = 0.0;
+            sumYY = 0.0;
+            for (int i = 0; i < count; i++) {
+                double diffX = dataX[i] - meanX;
+                double diffY = dataY[i] - meanY;
+                sumXY += diffX * diffY;
+                sumXX += diffX * diffX;
+                sumYY += diffY * diffY;
+            }
+        }
+
+        const Kernels scalarKernels = {
+            SimdLevel::Scalar, sumScalar, shiftedSumsScalar, sumAbsDiffScalar, crossSumsScalar
+        };
+
+#if STATISTICS_X86_SIMD
+        // SSE2 kernels: 4 floats per step, widened to two pairs of doubles
+
+        __attribute__((target("sse2")))
+        inline double horizontalSumSse2(__m128d v) {
+            return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+        }
+
+        __attribute__((target("sse2")))
+        double sumSse2(const float* data, int count) {
+            __m128d acc0 = _mm_setzero_pd();
+            __m128d acc1 = _mm_setzero_pd();
+            int i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 v = _mm_loadu_ps(data + i);
+                acc0 = _mm_add_pd(acc0, _mm_cvtps_pd(v));
+                acc1 = _mm_add_pd(acc1, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+            }
+            return horizontalSumSse2(_mm_add_pd(acc0, acc1)) + sumScalar(data + i, count - i);
+        }
+
+        __attribute__((target("sse2")))
+        void shiftedSumsSse2(const float* data, int count, double shift, double& sum, double& sumSquares) {
+            const __m128d shiftV = _mm_set1_pd(shift);
+            __m128d sum0 = _mm_setzero_pd(), sum1 = _mm_setzero_pd();
+            __m128d sq0 = _mm_setzero_pd(), sq1 = _mm_setzero_pd();
+            int i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 v = _mm_loadu_ps(data + i);
+                __m128d d0 = _mm_sub_pd(_mm_cvtps_pd(v), shiftV);
+                __m128d d1 = _mm_sub_pd(_mm_cvtps_pd(_mm_movehl_ps(v, v)), shiftV);
+                sum0 = _mm_add_pd(sum0, d0);
+                sum1 = _mm_add_pd(sum1, d1);
+                sq0 = _mm_add_pd(sq0, _mm_mul_pd(d0, d0));
+                sq1 = _mm_add_pd(sq1, _mm_mul_pd(d1, d1));
+            }
+            double tailSum, tailSquares;
+            shiftedSumsScalar(data + i, count - i, shift, tailSum, tailSquares);
+            sum = horizontalSumSse2(_mm_add_pd(sum0, sum1)) + tailSum;
+            sumSquares = horizontalSumSse2(_mm_add_pd(sq0, sq1)) + tailSquares;
+        }
+
+        __attribute__((target("sse2")))
+        double sumAbsDiffSse2(const float* data, int count, double center) {
+            const __m128d centerV = _mm_set1_pd(center);
+            const __m128d absMask = _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffLL));
+            __m128d acc0 = _mm_setzero_pd();
+            __m128d acc1 = _mm_setzero_pd();
+            int i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 v = _mm_loadu_ps(data + i);
+                __m128d d0 = _mm_sub_pd(_mm_cvtps_pd(v), centerV);
+                __m128d d1 = _mm_sub_pd(_mm_cvtps_pd(_mm_movehl_ps(v, v)), centerV);
+                acc0 = _mm_add_pd(acc0, _mm_and_pd(d0, absMask));
+                acc1 = _mm_add_pd(acc1, _mm_and_pd(d1, absMask));
+            }
+            return horizontalSumSse2(_mm_add_pd(acc0, acc1)) + sumAbsDiffScalar(data + i, count - i, center);
+        }
+
+        __attribute__((target("sse2")))
+        void crossSumsSse2(const float* dataX, const float* dataY, int count, double meanX, double meanY,
+                           double& sumXY, double& sumXX, double& sumYY) {
+            const __m128d meanXV = _mm_set1_pd(meanX);
+            const __m128d meanYV = _mm_set1_pd(meanY);
+            __m128d xy = _mm_setzero_pd(), xx = _mm_setzero_pd(), yy = _mm_setzero_pd();
+            int i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 vx = _mm_loadu_ps(dataX + i);
+                __m128 vy = _mm_loadu_ps(dataY + i);
+                __m128d dx0 = _mm_sub_pd(_mm_cvtps_pd(vx), meanXV);
+                __m128d dx1 = _mm_sub_pd(_mm_cvtps_pd(_mm_movehl_ps(vx, vx)), meanXV);
+                __m128d dy0 = _mm_sub_pd(_mm_cvtps_pd(vy), meanYV);
+                __m128d dy1 = _mm_sub_pd(_mm_cvtps_pd(_mm_movehl_ps(vy, vy)), meanYV);
+                xy = _mm_add_pd(xy, _mm_add_pd(_mm_mul_pd(dx0, dy0), _mm_mul_pd(dx1, dy1)));
+                xx = _mm_add_pd(xx, _mm_add_pd(_mm_mul_pd(dx0, dx0), _mm_mul_pd(dx1, dx1)));
+                yy = _mm_add_pd(yy, _mm_add_pd(_mm_mul_pd(dy0, dy0), _mm_mul_pd(dy1, dy1)));
+            }
+            double tailXY, tailXX, tailYY;
+            crossSumsScalar(dataX + i, dataY + i, count - i, meanX, meanY, tailXY, tailXX, tailYY);
+            sumXY = horizontalSumSse2(xy) + tailXY;
+            sumXX = horizontalSumSse2(xx) + tailXX;
+            sumYY = horizontalSumSse2(yy) + tailYY;
+        }
+
+        const Kernels sse2Kernels = {
+            SimdLevel::SSE2, sumSse2, shiftedSumsSse2, sumAbsDiffSse2, crossSumsSse2
+        };
+
+        // AVX2 kernels: 8 floats per step, widened to two sets of four doubles
+
+        __attribute__((target("avx2")))
+        inline double horizontalSumAvx2(__m256d v) {
+            __m128d pair = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+            return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+        }
+
+        __attribute__((target("avx2")))
+        double sumAvx2(const float* data, int count) {
+            __m256d acc0 = _mm256_setzero_pd();
+            __m256d acc1 = _mm256_setzero_pd();
+            int i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 v = _mm256_loadu_ps(data + i);
+                acc0 = _mm256_add_pd(acc0, _mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+                acc1 = _mm256_add_pd(acc1, _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+            }
+            return horizontalSumAvx2(_mm256_add_pd(acc0, acc1)) + sumScalar(data + i, count - i);
+        }
+
+        __attribute__((target("avx2")))
+        void shiftedSumsAvx2(const float* data, int count, double shift, double& sum, double& sumSquares) {
+            const __m256d shiftV = _mm256_set1_pd(shift);
+            __m256d sum0 = _mm256_setzero_pd(), sum1 = _mm256_setzero_pd();
+            __m256d sq0 = _mm256_setzero_pd(), sq1 = _mm256_setzero_pd();
+            int i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 v = _mm256_loadu_ps(data + i);
+                __m256d d0 = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(v)), shiftV);
+                __m256d d1 = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)), shiftV);
+                sum0 = _mm256_add_pd(sum0, d0);
+                sum1 = _mm256_add_pd(sum1, d1);
+                sq0 = _mm256_add_pd(sq0, _mm256_mul_pd(d0, d0));
+                sq1 = _mm256_add_pd(sq1, _mm256_mul_pd(d1, d1));
+            }
+            double tailSum, tailSquares;
+            shiftedSumsScalar(data + i, count - i, shift, tailSum, tailSquares);
+            sum = horizontalSumAvx2(_mm256_add_pd(sum0, sum1)) + tailSum;
+            sumSquares = horizontalSumAvx2(_mm256_add_pd(sq0, sq1)) + tailSquares;
+        }
+
+        __attribute__((target("avx2")))
+        double sumAbsDiffAvx2(const float* data, int count, double center) {
+            const __m256d centerV = _mm256_set1_pd(center);
+            const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+            __m256d acc0 = _mm256_setzero_pd();
+            __m256d acc1 = _mm256_setzero_pd();
+            int i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 v = _mm256_loadu_ps(data + i);
+                __m256d d0 = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(v)), centerV);
+                __m256d d1 = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)), centerV);
+                acc0 = _mm256_add_pd(acc0, _mm256_and_pd(d0, absMask));
+                acc1 = _mm256_add_pd(acc1, _mm256_and_pd(d1, absMask));
+            }
+            return horizontalSumAvx2(_mm256_add_pd(acc0, acc1)) + sumAbsDiffScalar(data + i, count - i, center);
+        }
+
+        __attribute__((target("avx2")))
+        void crossSumsAvx2(const float* dataX, const float* dataY, int count, double meanX, double meanY,
+                           double& sumXY, double& sumXX, double& sumYY) {
+            const __m256d meanXV = _mm256_set1_pd(meanX);
+            const __m256d meanYV = _mm256_set1_pd(meanY);
+            __m256d xy = _mm256_setzero_pd(), xx = _mm256_setzero_pd(), yy = _mm256_setzero_pd();
+            int i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 vx = _mm256_loadu_ps(dataX + i);
+                __m256 vy = _mm256_loadu_ps(dataY + i);
+                __m256d dx0 = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(vx)), meanXV);
+                __m256d dx1 = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(vx, 1)), meanXV);
+                __m256d dy0 = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(vy)), meanYV);
+                __m256d dy1 = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(vy, 1)), meanYV);
+                xy = _mm256_add_pd(xy, _mm256_add_pd(_mm256_mul_pd(dx0, dy0), _mm256_mul_pd(dx1, dy1)));
+                xx = _mm256_add_pd(xx, _mm256_add_pd(_mm256_mul_pd(dx0, dx0), _mm256_mul_pd(dx1, dx1)));
+                yy = _mm256_add_pd(yy, _mm256_add_pd(_mm256_mul_pd(dy0, dy0), _mm256_mul_pd(dy1, dy1)));
+            }
+            double tailXY, tailXX, tailYY;
+            crossSumsScalar(dataX + i, dataY + i, count - i, meanX, meanY, tailXY, tailXX, tailYY);
+            sumXY = horizontalSumAvx2(xy) + tailXY;
+            sumXX = horizontalSumAvx2(xx) + tailXX;
+            sumYY = horizontalSumAvx2(yy) + tailYY;
+        }
+
+        const Kernels avx2Kernels = {
+            SimdLevel::AVX2, sumAvx2, shiftedSumsAvx2, sumAbsDiffAvx2, crossSumsAvx2
+        };
+#endif // STATISTICS_X86_SIMD
+
+        // Runtime dispatch
+
+        bool isSupported(SimdLevel level) {
+#if STATISTICS_X86_SIMD
+            __builtin_cpu_init();
+            if (level == SimdLevel::AVX2) {
+                return __builtin_cpu_supports("avx2");
+            }
+            if (level == SimdLevel::SSE2) {
+                return __builtin_cpu_supports("sse2");
+            }
+#endif
+            return level == SimdLevel::Scalar;
+        }
+
+        const Kernels* kernelsFor(SimdLevel level) {
+#if STATISTICS_X86_SIMD
+            if (level == SimdLevel::AVX2) {
+                return &avx2Kernels;
+            }
+            if (level == SimdLevel::SSE2) {
+                return &sse2Kernels;
+            }
+#else
+            (void)level;
+#endif
+            return &scalarKernels;
+        }
+
+        /// Kernels in use, the best supported level until setSimdLevel changes it
+        const Kernels*& activeKernels() {
+            static const Kernels* active = kernelsFor(
+                isSupported(SimdLevel::AVX2) ? SimdLevel::AVX2 :
+                isSupported(SimdLevel::SSE2) ? SimdLevel::SSE2 : SimdLevel::Scalar);
+            return active;
+        }
+    }
+
+    SimdLevel getSimdLevel() {
+        return activeKernels()->level;
+    }
+
+    bool setSimdLevel(SimdLevel level) {
+        if (!isSupported(level)) {
+            return false;
+        }
+        activeKernels() = kernelsFor(level);
+        return true;
+    }
+
+    const char* simdLevelName(SimdLevel level) {
+        switch (level) {
+            case SimdLevel::AVX2: return "avx2";
+            case SimdLevel::SSE2: return "sse2";
+            default: return "scalar";
+        }
+    }
+
+    // Span versions
+
+    float calculateMean(const float* data, int count) {
+        if (count == 0) {
             return 0.0f;
         }
+        return static_cast<float>(activeKernels()->sum(data, count) / count);
+    }
 
-        float sum = 0.0f;
-        for (int i = 0; i < data.size(); i++) {
-            sum += data[i];
+    float calculateStandardDeviation(const float* data, int count, float mean) {
+        if (count <= 1) {
+            return 0.0f;
         }
 
-        return sum / data.size();
+        double sumDiff, sumSquareDiff;
+        activeKernels()->shiftedSums(data, count, mean, sumDiff, sumSquareDiff);
+        return static_cast<float>(std::sqrt(sumSquareDiff / (count - 1)));
     }
 
-    float calculateStandardDeviation(const Vector<float>& data, float mean) {
-        if (data.size() <= 1) {
+    float calculateSum(const float* data, int count) {
+        return static_cast<float>(activeKernels()->sum(data, count));
+    }
+
+    float calculatesPCC(const float* dataX, const float* dataY, int count) {
+        if (count < 2) {
+            return 0.0f; // Need at least 2 points for correlation
+        }
+
+        const Kernels* kernels = activeKernels();
+        double meanX = kernels->sum(dataX, count) / count;
+        double meanY = kernels->sum(dataY, count) / count;
+
+        double numerator, sumSquareX, sumSquareY;
+        kernels->crossSums(dataX, dataY, count, meanX, meanY, numerator, sumSquareX, sumSquareY);
+
+        // Avoid division by zero
+        double denominator = std::sqrt(sumSquareX * sumSquareY);
+        if (denominator == 0.0) {
             return 0.0f;
         }
+        return static_cast<float>(numerator / denominator);
+    }
 
-        float sumSquareDiff = 0.0f;
-        for (int i = 0; i < data.size(); i++) {
-            float diff = data[i] - mean;
-            sumSquareDiff += diff * diff;
+    float calculateMAD(const float* data, int count, float mean) {
+        if (count == 0) {
+            return 0.0f;
         }
+        return static_cast<float>(activeKernels()->sumAbsDiff(data, count, mean) / count);
+    }
 
-        return std::sqrt(sumSquareDiff / (data.size() - 1));
+    void calculateDescriptiveStats(const float* data, int count, DescriptiveStats& stats) {
+        stats = DescriptiveStats();
+        if (count == 0) {
+            return;
+        }
+
+        // Pass 1: sums of the differences from the first value, which is close
+        // enough to the mean that the variance keeps its precision
+        const Kernels* kernels = activeKernels();
+        double shift = data[0];
+        double sumDiff, sumSquareDiff;
+        kernels->shiftedSums(data, count, shift, sumDiff, sumSquareDiff);
+        double mean = shift + sumDiff / count;
+        double spread = sumSquareDiff - sumDiff * sumDiff / count;
+        if (spread < 0.0) {
+            spread = 0.0;   // rounding residue when every value is the same
+        }
+
+        // Pass 2: absolute differences from the mean
+        double sumAbsoluteDiff = kernels->sumAbsDiff(data, count, mean);
+
+        stats.count = count;
+        stats.mean = static_cast<float>(mean);
+        stats.stdev = (count > 1) ? static_cast<float>(std::sqrt(spread / (count - 1))) : 0.0f;
+        stats.mad = static_cast<float>(sumAbsoluteDiff / count);
+    }
+
+    // Vector versions, passing their storage to the span versions
+
+    float calculateMean(const Vector<float>& data) {
+        return calculateMean(data.begin(), data.size());
+    }
+
+    float calculateStandardDeviation(const Vector<float>& data, float mean) {
+        return calculateStandardDeviation(data.begin(), data.size(), mean);
     }
 
     float calculateStandardDeviation(const Vector<float>& data) {
@@ -43,11 +416,7 @@ namespace statistics {
     }
 
     float calculateSum(const Vector<float>& data) {
-        float sum = 0.0f;
-        for (int i = 0; i < data.size(); i++) {
-            sum += data[i];
-        }
-        return sum;
+        return calculateSum(data.begin(), data.size());
     }
 
     float calculatesPCC(const Vector<float>& dataX, const Vector<float>& dataY) {
@@ -55,61 +424,103 @@ namespace statistics {
         if (dataX.size() != dataY.size() || dataX.size() == 0) {
             return 0.0f;
         }
+        return calculatesPCC(dataX.begin(), dataY.begin(), dataX.size());
+    }
 
-        int n = dataX.size();
-        if (n < 2) {
-            return 0.0f; // Need at least 2 points for correlation
+    float calculateMAD(const Vector<float>& data) {
+        if (data.size() == 0) {
+            return 0.0f;
         }
 
-        // Calculate means
-        float meanX = calculateMean(dataX);
-        float meanY = calculateMean(dataY);
+        float mean = calculateMean(data);
+        return calculateMAD(data, mean);
+    }
 
-        // Calculate numerator
-        float numerator = 0.0f;
-        float sumSquareX = 0.0f;
-        float sumSquareY = 0.0f;
+    float calculateMAD(const Vector<float>& data, float mean) {
+        return calculateMAD(data.begin(), data.size(), mean);
+    }
 
-        for (int i = 0; i < n; i++) {
-            float diffX = dataX[i] - meanX;
-            float diffY = dataY[i] - meanY;
+    void calculateDescriptiveStats(const Vector<float>& data, DescriptiveStats& stats) {
+        calculateDescriptiveStats(data.begin(), data.size(), stats);
+    }
 
-            numerator += diffX * diffY;
-            sumSquareX += diffX * diffX;
-            sumSquareY += diffY * diffY;
-        }
+    // Moment summaries
 
-        // Calculate denominator
-        float denominator = std::sqrt(sumSquareX * sumSquareY);
+    void Moments::add(double value) {
+        count++;
+        sum += value;
+        sumSquares += value * value;
+    }
 
-        // Avoid division by zero
-        if (denominator == 0.0f) {
-            return 0.0f;
+    void Moments::merge(const Moments& other) {
+        count += other.count;
+        sum += other.sum;
+        sumSquares += other.sumSquares;
+    }
+
+    double Moments::mean() const {
+        if (count == 0) {
+            return 0.0;
         }
+        return sum / count;
+    }
 
-        return numerator / denominator;
+    double Moments::standardDeviation() const {
+        if (count <= 1) {
+            return 0.0;
+        }
+
+        // rounding can leave a tiny negative value when every value is the same
+        double sumSquareDiff = sumSquares - sum * sum / count;
+        if (sumSquareDiff < 0.0) {
+            sumSquareDiff = 0.0;
+        }
+        return std::sqrt(sumSquareDiff / (count - 1));
     }
 
-    float calculateMAD(const Vector<float>& data) {
-        if (data.size() == 0) {
+    float calculatesPCC(const Moments& x, const Moments& y, double sumProducts) {
+        int n = x.count;
+        if (n < 2 || y.count != n) {
+            return 0.0f; // Need at least 2 points for correlation
+        }
+
+        // Same sums as the Vector version, expanded around the means
+        double numerator = sumProducts - x.sum * y.sum / n;
+        double sumSquareX = x.sumSquares - x.sum * x.sum / n;
+        double sumSquareY = y.sumSquares - y.sum * y.sum / n;
+
+        // Avoid division by zero; a constant variable can leave a rounding residue
+        // instead of exactly 0, so anything that small counts as no spread
+        if (sumSquareX <= x.sumSquares * 1e-12 || sumSquareY <= y.sumSquares * 1e-12) {
             return 0.0f;
         }
 
-        float mean = calculateMean(data);
-        return calculateMAD(data, mean);
+        return static_cast<float>(numerator / std::sqrt(sumSquareX * sumSquareY));
     }
 
-    float calculateMAD(const Vector<float>& data, float mean) {
-        if (data.size() == 0) {
-            return 0.0f;
+    float calculateWeightedMAD(const float* values, const int* counts, int distinct, double mean) {
+        long long total = 0;
+        double sumAbsoluteDiff = 0.0;
+        for (int i = 0; i < distinct; i++) {
+            if (counts[i] != 0) {
+                total += counts[i];
+                sumAbsoluteDiff += counts[i] * std::fabs(values[i] - mean);
+            }
         }
+        return (total == 0) ? 0.0f : static_cast<float>(sumAbsoluteDiff / total);
+    }
 
-        float sumAbsoluteDiff = 0.0f;
-        for (int i = 0; i < data.size(); i++) {
-            sumAbsoluteDiff += std::abs(data[i] - mean);
+    void calculateDescriptiveStats(const float* data, int count, const Moments& moments, DescriptiveStats& stats) {
+        stats = DescriptiveStats();
+        if (count == 0) {
+            return;
         }
 
-        return sumAbsoluteDiff / data.size();
+        double mean = moments.mean();
+        stats.count = count;
+        stats.mean = static_cast<float>(mean);
+        stats.stdev = static_cast<float>(moments.standardDeviation());
+        stats.mad = static_cast<float>(activeKernels()->sumAbsDiff(data, count, mean) / count);
     }
 
 } // namespace statistics
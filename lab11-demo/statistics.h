@@ -2,6 +2,7 @@
 #define STATISTICS_H
 
 #include "vector.h"
+#include <cmath>
 
 /**
  * @file statistics.h
@@ -9,8 +10,19 @@
  * @author Dhruv Goswami
  * @date 20/06/2025
  *
- * All functions work with generic Vector<float> to ensure NO coupling to weather data types
+ * All functions work with generic Vector<float>, raw float spans, strided views or plain
+ * moment sums to ensure NO coupling to weather data types
  * This allows reuse with any numeric data, not just weather measurements
+ *
+ * The reductions run on contiguous float spans (the Vector versions pass their
+ * storage straight through, no per-element bounds check). On x86 the widest of
+ * AVX2 and SSE2 that the CPU supports is picked at runtime; elsewhere, or with
+ * setSimdLevel(SimdLevel::Scalar), a scalar loop does the same work.
+ *
+ * Every level converts the floats to double and accumulates in double; they
+ * only differ in the order the partial sums are added. Results therefore agree
+ * to within 1e-6 relative (a few float ulps) between levels, and to within 1e-6
+ * absolute for sPCC, whose value can be near zero. testStatistics.cpp checks this.
  */
 
 /**
@@ -69,6 +81,517 @@ namespace statistics {
      * @return Mean absolute deviation from the given mean
      */
     float calculateMAD(const Vector<float>& data, float mean);
+
+    /**
+     * @struct DescriptiveStats
+     * @brief Results of calculateDescriptiveStats
+     */
+    struct DescriptiveStats {
+        int count = 0;          ///< Number of values
+        float mean = 0.0f;      ///< Arithmetic mean, 0.0 if there are no values
+        float stdev = 0.0f;     ///< Sample standard deviation ((n-1) denominator), 0.0 for fewer than 2 values
+        float mad = 0.0f;       ///< Mean absolute deviation from the mean, 0.0 if there are no values
+    };
+
+    /**
+     * @brief Calculates count, mean, standard deviation and MAD together
+     *
+     * Two passes instead of the three that calculateMean, calculateStandardDeviation
+     * and calculateMAD make: the first sums the differences from the first value
+     * and their squares (the shifted data method, as accurate as Welford's for
+     * float input but free of its loop carried division, so it vectorizes), the
+     * second sums the absolute differences from the mean.
+     *
+     * @param data Vector containing float values
+     * @param stats Output for all four results
+     */
+    void calculateDescriptiveStats(const Vector<float>& data, DescriptiveStats& stats);
+
+    // Span versions of the functions above, data points at count contiguous values
+
+    /**
+     * @brief Calculates the arithmetic mean of a span
+     * @param data First value
+     * @param count Number of values
+     * @return Mean value, or 0.0 if count is 0
+     */
+    float calculateMean(const float* data, int count);
+
+    /**
+     * @brief Calculates standard deviation of a span with known mean
+     * @param data First value
+     * @param count Number of values
+     * @param mean Pre-calculated mean of the values
+     * @return Sample standard deviation using (n-1) denominator
+     */
+    float calculateStandardDeviation(const float* data, int count, float mean);
+
+    /**
+     * @brief Calculates the sum of a span
+     * @param data First value
+     * @param count Number of values
+     * @return Sum of all values
+     */
+    float calculateSum(const float* data, int count);
+
+    /**
+     * @brief Calculates sPCC of two spans of paired values
+     * @param dataX First X value
+     * @param dataY First Y value
+     * @param count Number of pairs
+     * @return Correlation coefficient between -1 and 1, or 0.0 if calculation impossible
+     */
+    float calculatesPCC(const float* dataX, const float* dataY, int count);
+
+    /**
+     * @brief Calculates Mean Absolute Deviation of a span with known mean
+     * @param data First value
+     * @param count Number of values
+     * @param mean Pre-calculated mean of the values
+     * @return Mean absolute deviation from the given mean
+     */
+    float calculateMAD(const float* data, int count, float mean);
+
+    /**
+     * @brief Calculates count, mean, standard deviation and MAD of a span together
+     * @param data First value
+     * @param count Number of values
+     * @param stats Output for all four results
+     */
+    void calculateDescriptiveStats(const float* data, int count, DescriptiveStats& stats);
+
+    /**
+     * @enum SimdLevel
+     * @brief Instruction sets the span reductions can run on
+     */
+    enum class SimdLevel {
+        Scalar,     ///< Plain loop, always available
+        SSE2,       ///< 4 floats per step
+        AVX2        ///< 8 floats per step
+    };
+
+    /**
+     * @brief Gets the level the reductions currently use
+     * @return Best level the CPU supports, unless changed with setSimdLevel
+     */
+    SimdLevel getSimdLevel();
+
+    /**
+     * @brief Forces a level, for tests and benchmarks; not safe while other threads calculate
+     * @param level Level to use
+     * @return true if the CPU and build support it, otherwise nothing changes
+     */
+    bool setSimdLevel(SimdLevel level);
+
+    /**
+     * @brief Gets a printable name for a level
+     * @param level Level to name
+     * @return "scalar", "sse2" or "avx2"
+     */
+    const char* simdLevelName(SimdLevel level);
+
+    /**
+     * @struct Moments
+     * @brief Running count, sum and sum of squares of one variable
+     *
+     * Summaries of two parts of a dataset merge by adding their fields, so they
+     * can be built once (per month, say) and queried later without the data.
+     * Sums are kept in double: the variance comes from sumSquares - sum^2 / n,
+     * which loses about log10(mean^2 / variance) of the 16 digits a double
+     * holds, far from the 2 to 4 digits the results are reported with.
+     */
+    struct Moments {
+        int count = 0;              ///< Number of values added
+        double sum = 0.0;           ///< Sum of the values
+        double sumSquares = 0.0;    ///< Sum of the squared values
+
+        /**
+         * @brief Adds one value
+         * @param value Value to add
+         */
+        void add(double value);
+
+        /**
+         * @brief Adds every value of another summary
+         * @param other Summary to merge in
+         */
+        void merge(const Moments& other);
+
+        /**
+         * @brief Arithmetic mean of the values added
+         * @return Mean value, or 0.0 if nothing was added
+         */
+        double mean() const;
+
+        /**
+         * @brief Sample standard deviation of the values added
+         * @return Standard deviation using (n-1) denominator, 0.0 for fewer than 2 values
+         */
+        double standardDeviation() const;
+    };
+
+    /**
+     * @brief Calculates sPCC from the moment summaries of two paired variables
+     * @param x Summary of the X values
+     * @param y Summary of the Y values (same count as x)
+     * @param sumProducts Sum of x[i] * y[i] over the pairs
+     * @return Correlation coefficient between -1 and 1, or 0.0 if calculation impossible
+     */
+    float calculatesPCC(const Moments& x, const Moments& y, double sumProducts);
+
+    /**
+     * @brief Calculates MAD of data given as a histogram of distinct values
+     *
+     * For streamed data that is not kept: each distinct value (or bin centre)
+     * with the number of times it occurred. The mean comes from a Moments
+     * summary of the same data. Exact when every value is one of values,
+     * otherwise off by at most the distance from a value to its bin centre.
+     *
+     * @param values Distinct values or bin centres
+     * @param counts Number of occurrences of each value
+     * @param distinct Number of entries in values and counts
+     * @param mean Mean of the data
+     * @return Mean absolute deviation, 0.0 if every count is zero
+     */
+    float calculateWeightedMAD(const float* values, const int* counts, int distinct, double mean);
+
+    /**
+     * @brief Calculates count, mean, standard deviation and MAD in one pass over a span
+     *
+     * For data whose Moments summary was built beforehand: the mean and
+     * standard deviation come from the summary, so the values are only read
+     * once, for the absolute differences from the mean.
+     *
+     * @param data First value
+     * @param count Number of values (the summary's count)
+     * @param moments Summary of the same values
+     * @param stats Output for all four results
+     */
+    void calculateDescriptiveStats(const float* data, int count, const Moments& moments, DescriptiveStats& stats);
+
+    /**
+     * @struct Identity
+     * @brief Projection that passes a float through unchanged
+     */
+    struct Identity {
+        float operator()(float value) const { return value; }
+    };
+
+    /**
+     * @class StridedView
+     * @brief Read-only view of count values taken stride elements apart, each passed through a projection
+     *
+     * Lets the statistics run where the values already are, without copying
+     * them into a Vector<float> first:
+     * - a field of an array of structs, e.g. the wind speed of WeatherRecords,
+     *   with a projection that reads the field;
+     * - every n-th value of a column, e.g. hourly values of 10 minute readings;
+     * - converted values, e.g. m/s read as km/h, with a projection that
+     *   converts each value as it is read.
+     *
+     * A view of unprojected floats with stride 1 is a span, and the view
+     * functions below hand it to the SIMD span kernels. Any other view is
+     * reduced by a scalar loop that, like the kernels, accumulates in double.
+     *
+     * analyzeWeather does not use views: its month values already sit in
+     * contiguous float columns, which the span functions read about twice as
+     * fast as a projected view of WeatherRecords (benchmark section 6), and
+     * WeatherSummary keeps only sums and histograms. Views are for callers
+     * that hold their data in another layout.
+     */
+    template <class Element, class Projection = Identity>
+    class StridedView {
+    public:
+        /**
+         * @brief Creates a view
+         * @param first First element
+         * @param count Number of values in the view
+         * @param stride Elements from one value to the next (1 for consecutive elements)
+         * @param projection Callable turning a const Element& into the float value
+         */
+        StridedView(const Element* first, int count, int stride = 1, Projection projection = Projection())
+            : first(first), count(count), stride(stride), projection(projection) {}
+
+        /**
+         * @brief Number of values
+         * @return Values in the view
+         */
+        int size() const { return count; }
+
+        /**
+         * @brief Reads a value
+         * @param index Position in the view (0 to size() - 1)
+         * @return Projected value of element first[index * stride]
+         */
+        float operator[](int index) const { return projection(first[index * stride]); }
+
+        /**
+         * @brief First element
+         * @return Pointer the view starts at
+         */
+        const Element* getFirst() const { return first; }
+
+        /**
+         * @brief Distance between values
+         * @return Stride in elements
+         */
+        int getStride() const { return stride; }
+
+    private:
+        const Element* first;   // First element
+        int count;              // Number of values
+        int stride;             // Elements from one value to the next
+        Projection projection;  // Element to value
+    };
+
+    /**
+     * @brief Creates a view of floats without projection
+     * @param first First value
+     * @param count Number of values
+     * @param stride Floats from one value to the next
+     * @return The view
+     */
+    inline StridedView<float> makeView(const float* first, int count, int stride = 1) {
+        return StridedView<float>(first, count, stride);
+    }
+
+    /**
+     * @brief Creates a view with a projection, deducing its types
+     * @param first First element
+     * @param count Number of values
+     * @param projection Callable turning a const Element& into the float value
+     * @param stride Elements from one value to the next
+     * @return The view
+     */
+    template <class Element, class Projection>
+    StridedView<Element, Projection> makeView(const Element* first, int count, Projection projection,
+                                              int stride = 1) {
+        return StridedView<Element, Projection>(first, count, stride, projection);
+    }
+
+    // View versions of the span functions, same results and edge cases
+
+    /**
+     * @brief Calculates the sum of a view
+     * @param view Values
+     * @return Sum of all values
+     */
+    template <class Element, class Projection>
+    float calculateSum(const StridedView<Element, Projection>& view);
+
+    /**
+     * @brief Calculates the arithmetic mean of a view
+     * @param view Values
+     * @return Mean value, or 0.0 if the view is empty
+     */
+    template <class Element, class Projection>
+    float calculateMean(const StridedView<Element, Projection>& view);
+
+    /**
+     * @brief Calculates the standard deviation of a view with known mean
+     * @param view Values
+     * @param mean Pre-calculated mean value
+     * @return Standard deviation using (n-1) denominator, 0.0 for fewer than 2 values
+     */
+    template <class Element, class Projection>
+    float calculateStandardDeviation(const StridedView<Element, Projection>& view, float mean);
+
+    /**
+     * @brief Calculates the mean absolute deviation of a view from a given mean
+     * @param view Values
+     * @param mean Pre-calculated mean value
+     * @return Mean absolute deviation, 0.0 if the view is empty
+     */
+    template <class Element, class Projection>
+    float calculateMAD(const StridedView<Element, Projection>& view, float mean);
+
+    /**
+     * @brief Calculates count, mean, standard deviation and MAD of a view in two passes
+     * @param view Values
+     * @param stats Output for all four results
+     */
+    template <class Element, class Projection>
+    void calculateDescriptiveStats(const StridedView<Element, Projection>& view, DescriptiveStats& stats);
+
+    /**
+     * @brief Calculates sPCC between two views of paired values
+     * @param viewX X values
+     * @param viewY Y values (same size as viewX)
+     * @return Correlation coefficient between -1 and 1, or 0.0 if calculation impossible
+     */
+    template <class ElementX, class ProjectionX, class ElementY, class ProjectionY>
+    float calculatesPCC(const StridedView<ElementX, ProjectionX>& viewX,
+                        const StridedView<ElementY, ProjectionY>& viewY);
+
+    /**
+     * @brief Gets the span behind a view, if it is one
+     * @param view Any view
+     * @return nullptr, only unprojected float views can be spans
+     */
+    template <class Element, class Projection>
+    const float* viewSpan(const StridedView<Element, Projection>& view) {
+        (void)view;
+        return nullptr;
+    }
+
+    /**
+     * @brief Gets the span behind a view of floats without projection
+     * @param view Float view
+     * @return First value if the stride is 1, otherwise nullptr
+     */
+    inline const float* viewSpan(const StridedView<float>& view) {
+        return (view.getStride() == 1) ? view.getFirst() : nullptr;
+    }
+}
+
+// Implementation of the view templates
+
+template <class Element, class Projection>
+float statistics::calculateSum(const StridedView<Element, Projection>& view) {
+    const float* span = viewSpan(view);
+    if (span != nullptr) {
+        return calculateSum(span, view.size());
+    }
+
+    double total = 0.0;
+    for (int i = 0; i < view.size(); i++) {
+        total += view[i];
+    }
+    return static_cast<float>(total);
+}
+
+template <class Element, class Projection>
+float statistics::calculateMean(const StridedView<Element, Projection>& view) {
+    if (view.size() == 0) {
+        return 0.0f;
+    }
+    const float* span = viewSpan(view);
+    if (span != nullptr) {
+        return calculateMean(span, view.size());
+    }
+
+    double total = 0.0;
+    for (int i = 0; i < view.size(); i++) {
+        total += view[i];
+    }
+    return static_cast<float>(total / view.size());
+}
+
+template <class Element, class Projection>
+float statistics::calculateStandardDeviation(const StridedView<Element, Projection>& view, float mean) {
+    if (view.size() <= 1) {
+        return 0.0f;
+    }
+    const float* span = viewSpan(view);
+    if (span != nullptr) {
+        return calculateStandardDeviation(span, view.size(), mean);
+    }
+
+    double sumSquareDiff = 0.0;
+    for (int i = 0; i < view.size(); i++) {
+        double diff = static_cast<double>(view[i]) - mean;
+        sumSquareDiff += diff * diff;
+    }
+    return static_cast<float>(std::sqrt(sumSquareDiff / (view.size() - 1)));
+}
+
+template <class Element, class Projection>
+float statistics::calculateMAD(const StridedView<Element, Projection>& view, float mean) {
+    if (view.size() == 0) {
+        return 0.0f;
+    }
+    const float* span = viewSpan(view);
+    if (span != nullptr) {
+        return calculateMAD(span, view.size(), mean);
+    }
+
+    double sumAbsoluteDiff = 0.0;
+    for (int i = 0; i < view.size(); i++) {
+        sumAbsoluteDiff += std::fabs(static_cast<double>(view[i]) - mean);
+    }
+    return static_cast<float>(sumAbsoluteDiff / view.size());
+}
+
+template <class Element, class Projection>
+void statistics::calculateDescriptiveStats(const StridedView<Element, Projection>& view, DescriptiveStats& stats) {
+    const float* span = viewSpan(view);
+    if (span != nullptr) {
+        calculateDescriptiveStats(span, view.size(), stats);
+        return;
+    }
+
+    stats = DescriptiveStats();
+    int count = view.size();
+    if (count == 0) {
+        return;
+    }
+
+    // Pass 1: shifted sums, as in the span version; each value is projected once per pass
+    double shift = view[0];
+    double sumDiff = 0.0;
+    double sumSquareDiff = 0.0;
+    for (int i = 0; i < count; i++) {
+        double diff = view[i] - shift;
+        sumDiff += diff;
+        sumSquareDiff += diff * diff;
+    }
+    double mean = shift + sumDiff / count;
+    double spread = sumSquareDiff - sumDiff * sumDiff / count;
+    if (spread < 0.0) {
+        spread = 0.0;   // rounding residue when every value is the same
+    }
+
+    // Pass 2: absolute differences from the mean
+    double sumAbsoluteDiff = 0.0;
+    for (int i = 0; i < count; i++) {
+        sumAbsoluteDiff += std::fabs(view[i] - mean);
+    }
+
+    stats.count = count;
+    stats.mean = static_cast<float>(mean);
+    stats.stdev = (count > 1) ? static_cast<float>(std::sqrt(spread / (count - 1))) : 0.0f;
+    stats.mad = static_cast<float>(sumAbsoluteDiff / count);
+}
+
+template <class ElementX, class ProjectionX, class ElementY, class ProjectionY>
+float statistics::calculatesPCC(const StridedView<ElementX, ProjectionX>& viewX,
+                                const StridedView<ElementY, ProjectionY>& viewY) {
+    int count = viewX.size();
+    if (count < 2 || viewY.size() != count) {
+        return 0.0f; // Need at least 2 paired points for correlation
+    }
+    const float* spanX = viewSpan(viewX);
+    const float* spanY = viewSpan(viewY);
+    if (spanX != nullptr && spanY != nullptr) {
+        return calculatesPCC(spanX, spanY, count);
+    }
+
+    double sumX = 0.0;
+    double sumY = 0.0;
+    for (int i = 0; i < count; i++) {
+        sumX += viewX[i];
+        sumY += viewY[i];
+    }
+    double meanX = sumX / count;
+    double meanY = sumY / count;
+
+    double numerator = 0.0;
+    double sumSquareX = 0.0;
+    double sumSquareY = 0.0;
+    for (int i = 0; i < count; i++) {
+        double diffX = viewX[i] - meanX;
+        double diffY = viewY[i] - meanY;
+        numerator += diffX * diffY;
+        sumSquareX += diffX * diffX;
+        sumSquareY += diffY * diffY;
+    }
+
+    // Avoid division by zero
+    double denominator = std::sqrt(sumSquareX * sumSquareY);
+    if (denominator == 0.0) {
+        return 0.0f;
+    }
+    return static_cast<float>(numerator / denominator);
 }
 
 #endif // STATISTICS_H
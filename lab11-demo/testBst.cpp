@@ -0,0 +1,638 @@
+/**
+ * @file testBst.cpp
+ * @brief Test program for the lab11-demo BinarySearchTree, its balanced mode, stack safety
+ *        node allocators, visitor traversals and the Map built on it (tree and flat)
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ *
+ * Not part of the lab11-demo build (it has its own main). Build it on its own:
+ *   g++ -std=c++14 -O2 testBst.cpp -o testBst
+ * Exits with 1 if any check fails.
+ */
+
+#include "bst.h"
+#include "map.h"
+#include <iostream>
+#include <chrono>
+#include <string>
+
+// Namespace usage - don't expose entire std namespace
+using std::cout;
+using std::endl;
+
+// Forward declarations
+void testBasicOperations();
+void testBalancedShape();
+void testBalancedSortedInsert();
+void testDegenerateTree();
+void testPoolAllocator();
+void testVisitorTraversals();
+void testMapStorage();
+void testFlatMap();
+template <class Tree>
+void timeTree(const char* label, const int* keys, int n);
+void check(bool condition, const char* description);
+double elapsedMs(std::chrono::steady_clock::time_point start);
+
+// Function pointer callback functions for testing
+void print(int& value);
+void collect(int& value);
+
+// State for the collect callback
+int collected[16];
+int collectedCount = 0;
+int lastSeen = 0;
+int visitCount = 0;
+bool inOrderSorted = true;
+void checkSorted(int& value);
+void countVisit(int& value);
+
+int failures = 0;
+
+// Map values that count their default constructions, and values without one
+struct DefaultCounted
+{
+    static int defaults;
+    int payload = 0;
+    DefaultCounted() { defaults++; }
+};
+int DefaultCounted::defaults = 0;
+
+struct NoDefault
+{
+    int payload;
+    explicit NoDefault(int value) : payload(value) {}
+};
+
+int main()
+{
+    cout << "=== lab11-demo Binary Search Tree Test Program ===" << endl << endl;
+
+    testBasicOperations();
+    testBalancedShape();
+    testBalancedSortedInsert();
+    testDegenerateTree();
+    testPoolAllocator();
+    testVisitorTraversals();
+    testMapStorage();
+    testFlatMap();
+
+    if (failures == 0)
+    {
+        cout << "=== All tests passed ===" << endl;
+        return 0;
+    }
+    cout << "=== " << failures << " check(s) FAILED ===" << endl;
+    return 1;
+}
+
+void testBasicOperations()
+{
+    cout << "1. Testing Basic BST Operations (plain and balanced):" << endl;
+    cout << "-----------------------------------------------------" << endl;
+
+    BinarySearchTree<int> plainTree;
+    BalancedSearchTree<int> balancedTree;
+
+    int values[] = {50, 30, 70, 20, 40, 60, 80, 10, 25, 35, 45, 50, 30};
+    int numValues = sizeof(values) / sizeof(values[0]);
+    for (int i = 0; i < numValues; i++)
+    {
+        plainTree.insertElement(values[i]);
+        balancedTree.insertElement(values[i]);
+    }
+
+    cout << "Plain in-order:    ";
+    plainTree.inOrderTraversal(print);
+    cout << endl;
+    cout << "Balanced in-order: ";
+    balancedTree.inOrderTraversal(print);
+    cout << endl;
+
+    check(plainTree.searchElement(40) && balancedTree.searchElement(40), "search finds 40");
+    check(!plainTree.searchElement(100) && !balancedTree.searchElement(100), "search misses 100");
+
+    BalancedSearchTree<int> copiedTree(balancedTree);
+    copiedTree.insertElement(100);
+    check(copiedTree.searchElement(100) && !balancedTree.searchElement(100), "copy is independent");
+
+    cout << endl;
+}
+
+void testBalancedShape()
+{
+    cout << "2. Testing AVL Rotations:" << endl;
+    cout << "-------------------------" << endl;
+
+    // sorted input, the plain tree would be a list 1 -> 2 -> ... -> 7
+    BalancedSearchTree<int> tree;
+    for (int i = 1; i <= 7; i++)
+    {
+        tree.insertElement(i);
+    }
+
+    collectedCount = 0;
+    tree.preOrderTraversal(collect);
+    int expected[] = {4, 2, 1, 3, 6, 5, 7};
+    bool sameShape = (collectedCount == 7);
+    for (int i = 0; sameShape && i < 7; i++)
+    {
+        sameShape = (collected[i] == expected[i]);
+    }
+    cout << "Pre-order after inserting 1..7: ";
+    tree.preOrderTraversal(print);
+    cout << endl;
+    check(sameShape, "sorted insert 1..7 gives pre-order 4 2 1 3 6 5 7");
+
+    // left-right and right-left double rotations
+    BalancedSearchTree<int> zigZag;
+    int zigValues[] = {30, 10, 20, 50, 40};
+    for (int i = 0; i < 5; i++)
+    {
+        zigZag.insertElement(zigValues[i]);
+    }
+    collectedCount = 0;
+    zigZag.preOrderTraversal(collect);
+    int zigExpected[] = {20, 10, 40, 30, 50};
+    bool zigShape = (collectedCount == 5);
+    for (int i = 0; zigShape && i < 5; i++)
+    {
+        zigShape = (collected[i] == zigExpected[i]);
+    }
+    check(zigShape, "double rotations give 20 10 40 30 50");
+
+    cout << endl;
+}
+
+void testBalancedSortedInsert()
+{
+    cout << "3. Stress Test, Balanced Sorted Insert (10,000,000 keys):" << endl;
+    cout << "---------------------------------------------------------" << endl;
+
+    const int n = 10000000;
+    auto start = std::chrono::steady_clock::now();
+    {
+        BalancedSearchTree<int> tree;
+        for (int i = 0; i < n; i++)
+        {
+            tree.insertElement(i);
+        }
+        cout << "Insert: " << elapsedMs(start) << " ms" << endl;
+
+        visitCount = 0;
+        lastSeen = -1;
+        inOrderSorted = true;
+        tree.inOrderTraversal(checkSorted);
+        check(visitCount == n && inOrderSorted, "in-order visits every key once, ascending");
+
+        bool allFound = true;
+        for (int i = 0; i < n; i += 997)
+        {
+            allFound = allFound && tree.searchElement(i);
+        }
+        check(allFound && !tree.searchElement(n) && !tree.searchElement(-1), "search after sorted insert");
+
+        start = std::chrono::steady_clock::now();
+    }
+    cout << "Destroy: " << elapsedMs(start) << " ms" << endl;
+
+    cout << endl;
+}
+
+void testDegenerateTree()
+{
+    cout << "4. Stack Safety, Plain Tree From Sorted Input (30,000 keys):" << endl;
+    cout << "-------------------------------------------------------------" << endl;
+
+    // without balancing every node hangs off the right of the previous one,
+    // a recursive walk would need 30,000 nested calls (the recursive version
+    // crashes here with a 512KB stack; run under "ulimit -s 256" to check)
+    const int n = 30000;
+    BinarySearchTree<int> tree;
+    for (int i = 0; i < n; i++)
+    {
+        tree.insertElement(i);
+    }
+    check(tree.searchElement(n - 1) && !tree.searchElement(n), "search at the bottom of the list");
+
+    visitCount = 0;
+    lastSeen = -1;
+    inOrderSorted = true;
+    tree.inOrderTraversal(checkSorted);
+    check(visitCount == n && inOrderSorted, "in-order traversal");
+
+    visitCount = 0;
+    lastSeen = -1;
+    inOrderSorted = true;
+    tree.preOrderTraversal(checkSorted);
+    check(visitCount == n && inOrderSorted, "pre-order traversal of a right list is ascending");
+
+    // a descending insert gives a list leaning the other way
+    BinarySearchTree<int> leftList;
+    for (int i = n - 1; i >= 0; i--)
+    {
+        leftList.insertElement(i);
+    }
+    visitCount = 0;
+    lastSeen = -1;
+    inOrderSorted = true;
+    leftList.postOrderTraversal(checkSorted);
+    check(visitCount == n && inOrderSorted, "post-order traversal of a left list is ascending");
+
+    BinarySearchTree<int> copiedTree(tree);
+    visitCount = 0;
+    copiedTree.postOrderTraversal(countVisit);
+    check(visitCount == n, "copy of the list");
+
+    copiedTree = leftList;
+    check(copiedTree.searchElement(0) && copiedTree.searchElement(n - 1), "assignment of the list");
+
+    tree.destroyTree();
+    check(!tree.searchElement(0), "destroy of the list");
+
+    // post-order on a small full tree: children before their parent
+    BinarySearchTree<int> small;
+    int values[] = {4, 2, 6, 1, 3, 5, 7};
+    for (int i = 0; i < 7; i++)
+    {
+        small.insertElement(values[i]);
+    }
+    collectedCount = 0;
+    small.postOrderTraversal(collect);
+    int expected[] = {1, 3, 2, 5, 7, 6, 4};
+    bool sameOrder = (collectedCount == 7);
+    for (int i = 0; sameOrder && i < 7; i++)
+    {
+        sameOrder = (collected[i] == expected[i]);
+    }
+    check(sameOrder, "post-order of 4 2 6 1 3 5 7 is 1 3 2 5 7 6 4");
+
+    cout << endl;
+}
+
+void testPoolAllocator()
+{
+    cout << "5. Pooled Node Allocator:" << endl;
+    cout << "-------------------------" << endl;
+
+    typedef BinarySearchTree<int, true, PoolNodeAllocator<int>> PooledTree;
+
+    PooledTree tree;
+    for (int i = 1; i <= 1000; i++)
+    {
+        tree.insertElement(i);
+    }
+    PooledTree copiedTree(tree);
+    tree.destroyTree();
+    check(!tree.searchElement(500) && copiedTree.searchElement(500), "copy keeps its own pool");
+
+    // the pool is usable again after a destroy
+    tree.insertElement(7);
+    check(tree.searchElement(7) && !tree.searchElement(8), "insert after destroy");
+
+    tree = copiedTree;
+    visitCount = 0;
+    lastSeen = 0;
+    inOrderSorted = true;
+    tree.inOrderTraversal(checkSorted);
+    check(visitCount == 1000 && inOrderSorted, "assignment copies every node");
+
+    // destructors still run for types that own memory
+    {
+        BinarySearchTree<std::string, true, PoolNodeAllocator<std::string>> names;
+        for (int i = 0; i < 10000; i++)
+        {
+            names.insertElement("a name long enough to be heap allocated " + std::to_string(i));
+        }
+        check(names.searchElement("a name long enough to be heap allocated 9999"), "pool with std::string keys");
+    }
+
+    // timings against the default allocator, keys in a scrambled order
+    const int n = 1000000;
+    int* keys = new int[n];
+    for (int i = 0; i < n; i++)
+    {
+        keys[i] = static_cast<int>((i * 2654435761u) % n);
+    }
+    timeTree<BalancedSearchTree<int>>("heap", keys, n);
+    timeTree<PooledTree>("pool", keys, n);
+    delete[] keys;
+
+    cout << endl;
+}
+
+/**
+ * @brief Times insert, search and destroy of one tree type
+ * @param label Name printed in front of the timings
+ * @param keys Keys to insert, then search for
+ * @param n Number of keys
+ */
+template <class Tree>
+void timeTree(const char* label, const int* keys, int n)
+{
+    Tree tree;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++)
+    {
+        tree.insertElement(keys[i]);
+    }
+    double insertMs = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    int found = 0;
+    for (int i = 0; i < n; i++)
+    {
+        found += tree.searchElement(keys[i]) ? 1 : 0;
+    }
+    double searchMs = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    tree.destroyTree();
+    double destroyMs = elapsedMs(start);
+
+    cout << "  " << label << ": insert " << insertMs << " ms, search " << searchMs
+         << " ms, destroy " << destroyMs << " ms" << endl;
+    check(found == n, "every key found");
+}
+
+void testVisitorTraversals()
+{
+    cout << "6. Traversals With Lambdas and Early Termination:" << endl;
+    cout << "-------------------------------------------------" << endl;
+
+    BalancedSearchTree<int> tree;
+    for (int i = 1; i <= 100; i++)
+    {
+        tree.insertElement(i);
+    }
+
+    // state lives in the caller, no globals
+    long long sum = 0;
+    int count = 0;
+    bool finished = tree.inOrderTraversal([&sum, &count](int& value) {
+        sum += value;
+        count++;
+    });
+    check(finished && sum == 5050 && count == 100, "capturing lambda sums 1..100");
+
+    int previous = 0;
+    bool ascending = true;
+    tree.inOrderTraversal([&previous, &ascending](int& value) {
+        ascending = ascending && value > previous;
+        previous = value;
+    });
+    check(ascending, "lambda sees in-order values ascending");
+
+    // a visitor returning false stops the walk
+    int visited = 0;
+    finished = tree.inOrderTraversal([&visited](int& value) {
+        visited++;
+        return value < 10;
+    });
+    check(!finished && visited == 10, "in-order stops at the first false");
+
+    visited = 0;
+    finished = tree.preOrderTraversal([&visited](int&) {
+        visited++;
+        return visited < 3;
+    });
+    check(!finished && visited == 3, "pre-order stops at the first false");
+
+    visited = 0;
+    finished = tree.postOrderTraversal([&visited](int&) {
+        visited++;
+        return true;
+    });
+    check(finished && visited == 100, "post-order runs to the end while the visitor returns true");
+
+    // plain function pointers still take the f1Typ overloads
+    visitCount = 0;
+    tree.postOrderTraversal(countVisit);
+    check(visitCount == 100, "function pointer traversal");
+
+    cout << endl;
+}
+
+void testMapStorage()
+{
+    cout << "7. Map Value Storage:" << endl;
+    cout << "---------------------" << endl;
+
+    Map<std::string, int> counts;
+    counts["01/2010"] = 5;
+    counts["02/2010"] += 2;
+    counts["01/2010"]++;
+    check(counts["01/2010"] == 6 && counts["02/2010"] == 2, "operator[] returns the stored value");
+
+    counts.insert("02/2010", 40);
+    counts.insert("03/2010", 7);
+    const int* found = counts.find("02/2010");
+    check(found != nullptr && *found == 40, "insert updates an existing key");
+    check(counts.find("04/2010") == nullptr, "find misses an absent key");
+
+    int* stored = counts.find("03/2010");
+    *stored = 70;
+    check(counts["03/2010"] == 70, "value updated through find");
+
+    // references stay valid while other keys are added and the tree rotates
+    int& first = counts["00/0000"];
+    for (int i = 0; i < 1000; i++)
+    {
+        counts[std::to_string(i)] = i;
+    }
+    first = 123;
+    const Map<std::string, int>& constCounts = counts;
+    check(*constCounts.find("00/0000") == 123 && *constCounts.find("999") == 999, "references survive rebalancing");
+
+    counts.clear();
+    check(counts.find("01/2010") == nullptr, "clear removes every key");
+
+    // lookups compare the key alone, a value is only built for a new key
+    Map<std::string, DefaultCounted> built;
+    built["a"].payload = 1;
+    built["b"].payload = 2;
+    int afterInserts = DefaultCounted::defaults;
+    built["a"].payload++;
+    const Map<std::string, DefaultCounted>& constBuilt = built;
+    check(built.find("b") != nullptr && constBuilt.find("a")->payload == 2 && built.find("c") == nullptr,
+          "lookups find the stored values");
+    check(afterInserts == 2 && DefaultCounted::defaults == 2, "lookups build no value");
+
+    Map<std::string, NoDefault> noDefault;
+    noDefault.insert("x", NoDefault(3));
+    noDefault.insert("x", NoDefault(4));
+    check(noDefault.find("x") != nullptr && noDefault.find("x")->payload == 4 && noDefault.find("y") == nullptr,
+          "insert and find need no default constructible value");
+
+    cout << endl;
+}
+
+void testFlatMap()
+{
+    cout << "8. Map With Integral Keys (flat sorted arrays):" << endl;
+    cout << "-----------------------------------------------" << endl;
+
+    Map<int, int> months;
+    months[2010 * 12 + 0] = 31;
+    months[2010 * 12 + 1] += 28;
+    months[2010 * 12 + 0]++;
+    check(months[2010 * 12 + 0] == 32 && months[2010 * 12 + 1] == 28, "operator[] returns the stored value");
+
+    months.insert(2010 * 12 + 1, 29);
+    const int* found = months.find(2010 * 12 + 1);
+    check(found != nullptr && *found == 29, "insert updates an existing key");
+    check(months.find(2009 * 12 + 11) == nullptr && months.find(2011 * 12) == nullptr,
+          "find misses keys before, between and after the stored ones");
+
+    // same operations on the tree Map (forced with FlatKeys = false) as the reference,
+    // keys ascending (the append path), descending (insert at the front) and scattered
+    Map<int, int> flat;
+    Map<int, int, false> tree;
+    unsigned int state = 12345u;
+    for (int i = 0; i < 3000; i++)
+    {
+        int key;
+        if (i < 1000)
+        {
+            key = i * 3;
+        }
+        else if (i < 2000)
+        {
+            key = -(i - 999);
+        }
+        else
+        {
+            state = state * 1664525u + 1013904223u;
+            key = static_cast<int>(state >> 20) - 2048;
+        }
+        flat[key] += i;
+        tree[key] += i;
+    }
+    bool same = true;
+    for (int key = -3000; key <= 3000 && same; key++)
+    {
+        const int* a = flat.find(key);
+        const int* b = tree.find(key);
+        same = (a == nullptr) == (b == nullptr) && (a == nullptr || *a == *b);
+    }
+    check(same, "flat Map matches the tree Map for ascending, descending and random keys");
+
+    flat.clear();
+    check(flat.find(0) == nullptr && flat.find(-5) == nullptr, "clear removes every key");
+
+    // the value inserted may live in the map itself; moving the tail up and
+    // growing the arrays must not change what gets stored
+    Map<int, Vector<int>> aliased;
+    for (int key = 0; key <= 38; key += 2)
+    {
+        Vector<int> pair;
+        pair.push_back(key);
+        pair.push_back(key);
+        aliased[key] = pair;
+    }
+    bool copiesIntact = true;
+    for (int key = 1; key < 38; key += 2)
+    {
+        aliased.insert(key, aliased[38]);
+        const Vector<int>* stored = aliased.find(key);
+        copiesIntact = copiesIntact && stored != nullptr && (*stored)[0] == 38 && (*stored)[1] == 38;
+    }
+    check(copiesIntact, "insert of a value stored in the map itself");
+
+    // 120 month keys, the size of the weather data index. Before the int keys a
+    // lookup built an "MM/YYYY" string and compared strings down the tree
+    Map<int, int> monthIndex;
+    Map<int, int, false> monthTree;
+    Map<std::string, int> monthStrings;
+    for (int key = 0; key < 120; key++)
+    {
+        monthIndex[24120 + key] = key;
+        monthTree[24120 + key] = key;
+        monthStrings[std::to_string(key % 12 + 1) + "/" + std::to_string(2010 + key / 12)] = key;
+    }
+    // months in random order, like menu queries, so no Map gets a predictable path
+    const int lookups = 1000000;
+    int* queries = new int[lookups];
+    unsigned int seed = 1u;
+    for (int i = 0; i < lookups; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        queries[i] = static_cast<int>((seed >> 8) % 120);
+    }
+    long long sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < lookups; i++)
+    {
+        sum += *monthIndex.find(24120 + queries[i]);
+    }
+    double flatMs = elapsedMs(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < lookups; i++)
+    {
+        sum -= *monthTree.find(24120 + queries[i]);
+    }
+    double treeMs = elapsedMs(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < lookups; i++)
+    {
+        int key = queries[i];
+        sum += *monthStrings.find(std::to_string(key % 12 + 1) + "/" + std::to_string(2010 + key / 12));
+        sum -= key;
+    }
+    double stringMs = elapsedMs(start);
+    delete[] queries;
+    cout << "  " << lookups << " lookups in 120 months: flat int " << flatMs << " ms, tree int " << treeMs
+         << " ms, tree string (key built per lookup) " << stringMs << " ms" << endl;
+    check(sum == 0, "every Map returns the same values");
+
+    cout << endl;
+}
+
+/**
+ * @brief Milliseconds since a start point
+ * @param start Time the measurement started
+ * @return Elapsed milliseconds
+ */
+double elapsedMs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void check(bool condition, const char* description)
+{
+    cout << (condition ? "  PASS: " : "  FAIL: ") << description << endl;
+    if (!condition)
+    {
+        failures++;
+    }
+}
+
+// Function pointer implementations
+void print(int& value)
+{
+    cout << value << " ";
+}
+
+void collect(int& value)
+{
+    if (collectedCount < 16)
+    {
+        collected[collectedCount++] = value;
+    }
+}
+
+void checkSorted(int& value)
+{
+    if (value <= lastSeen)
+    {
+        inOrderSorted = false;
+    }
+    lastSeen = value;
+    visitCount++;
+}
+
+void countVisit(int& value)
+{
+    (void)value;
+    visitCount++;
+}
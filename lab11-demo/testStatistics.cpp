@@ -0,0 +1,353 @@
+/**
+ * @file testStatistics.cpp
+ * @brief Test program for the statistics reductions and their SIMD levels
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ *
+ * Not part of the lab11-demo build (it has its own main). Build it on its own:
+ *   g++ -std=c++14 -O2 testStatistics.cpp statistics.cpp -o testStatistics
+ * Exits with 1 if any check fails.
+ *
+ * Tolerance (documented in statistics.h): every level accumulates in double,
+ * so each result must match the scalar level to within 1e-6 relative, sPCC to
+ * within 1e-6 absolute, and all of them must match a long double reference
+ * to the same bounds.
+ */
+
+#include "statistics.h"
+#include <iostream>
+#include <cmath>
+
+// Namespace usage - don't expose entire std namespace
+using std::cout;
+using std::endl;
+
+// Forward declarations
+void testKnownValues();
+void testLevelsAgree();
+void testViews();
+void fillData(Vector<float>& data, int count, float low, float high, unsigned int seed);
+bool closeRelative(double actual, double expected, double tolerance);
+void check(bool condition, const char* description);
+
+const double relativeTolerance = 1e-6;
+const double pccTolerance = 1e-6;
+
+// Every level this CPU supports, scalar first
+statistics::SimdLevel levels[3];
+int levelCount = 0;
+
+int failures = 0;
+
+/**
+ * @brief Record with two readings, for the views over an array of structs
+ */
+struct Reading
+{
+    float first;    ///< Read through a projection
+    float second;   ///< Interleaved with first
+};
+
+int main()
+{
+    cout << "=== lab11-demo Statistics Test Program ===" << endl << endl;
+
+    statistics::SimdLevel best = statistics::getSimdLevel();
+    statistics::SimdLevel all[] = {statistics::SimdLevel::Scalar, statistics::SimdLevel::SSE2,
+                                   statistics::SimdLevel::AVX2};
+    for (int i = 0; i < 3; i++)
+    {
+        if (statistics::setSimdLevel(all[i]))
+        {
+            levels[levelCount++] = all[i];
+        }
+    }
+    statistics::setSimdLevel(best);
+
+    cout << "Default level: " << statistics::simdLevelName(best) << ", testing:";
+    for (int i = 0; i < levelCount; i++)
+    {
+        cout << " " << statistics::simdLevelName(levels[i]);
+    }
+    cout << endl << endl;
+
+    testKnownValues();
+    testLevelsAgree();
+    testViews();
+
+    statistics::setSimdLevel(best);
+    if (failures == 0)
+    {
+        cout << "=== All tests passed ===" << endl;
+        return 0;
+    }
+    cout << "=== " << failures << " check(s) FAILED ===" << endl;
+    return 1;
+}
+
+void testKnownValues()
+{
+    cout << "1. Testing Known Values (every level):" << endl;
+    cout << "--------------------------------------" << endl;
+
+    // 11 values so the vector loops run and leave a scalar tail
+    Vector<float> x;
+    Vector<float> y;
+    for (int i = 1; i <= 11; i++)
+    {
+        x.push_back(static_cast<float>(i));
+        y.push_back(static_cast<float>(2 * i + 1));
+    }
+    Vector<float> empty;
+
+    for (int l = 0; l < levelCount; l++)
+    {
+        statistics::setSimdLevel(levels[l]);
+        cout << "  " << statistics::simdLevelName(levels[l]) << ":" << endl;
+
+        check(statistics::calculateSum(x) == 66.0f, "sum of 1..11 is 66");
+        check(statistics::calculateMean(x) == 6.0f, "mean of 1..11 is 6");
+        check(closeRelative(statistics::calculateStandardDeviation(x), std::sqrt(11.0), 1e-7),
+              "sample stdev of 1..11 is sqrt(11)");
+        check(closeRelative(statistics::calculateMAD(x), 30.0 / 11.0, 1e-7), "MAD of 1..11 is 30/11");
+        check(std::fabs(statistics::calculatesPCC(x, y) - 1.0f) < 1e-6f, "sPCC of a line is 1");
+
+        statistics::DescriptiveStats stats;
+        statistics::calculateDescriptiveStats(x, stats);
+        check(stats.count == 11 && stats.mean == 6.0f &&
+              closeRelative(stats.stdev, std::sqrt(11.0), 1e-7) &&
+              closeRelative(stats.mad, 30.0 / 11.0, 1e-7), "descriptive stats of 1..11");
+
+        statistics::Moments moments;
+        for (int i = 0; i < x.size(); i++)
+        {
+            moments.add(x[i]);
+        }
+        statistics::calculateDescriptiveStats(x.begin(), x.size(), moments, stats);
+        check(stats.count == 11 && stats.mean == 6.0f &&
+              closeRelative(stats.stdev, std::sqrt(11.0), 1e-7) &&
+              closeRelative(stats.mad, 30.0 / 11.0, 1e-7), "one pass descriptive stats of 1..11");
+
+        statistics::calculateDescriptiveStats(empty, stats);
+        check(stats.count == 0 && statistics::calculateSum(empty) == 0.0f &&
+              statistics::calculateMean(empty) == 0.0f, "empty data gives zeros");
+    }
+
+    cout << endl;
+}
+
+void testLevelsAgree()
+{
+    cout << "2. Testing Every Level Against Scalar and a long double Reference:" << endl;
+    cout << "------------------------------------------------------------------" << endl;
+
+    // sizes around the 4 and 8 wide steps, plus large ones; ranges like wind,
+    // temperature and solar radiation, and one far from zero to stress the shift
+    int sizes[] = {1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 4464, 1000003};
+    float lows[] = {0.0f, -5.0f, 0.0f, 10000.0f};
+    float highs[] = {60.0f, 45.0f, 1100.0f, 10001.0f};
+    int numSizes = sizeof(sizes) / sizeof(sizes[0]);
+    int numRanges = sizeof(lows) / sizeof(lows[0]);
+
+    int compared = 0;
+    double worstRelative = 0.0;
+    double worstPcc = 0.0;
+    bool allClose = true;
+
+    for (int s = 0; s < numSizes; s++)
+    {
+        for (int r = 0; r < numRanges; r++)
+        {
+            Vector<float> x;
+            Vector<float> y;
+            fillData(x, sizes[s], lows[r], highs[r], 17 + s * 31 + r);
+            fillData(y, sizes[s], lows[r], highs[r], 1234 + s * 7 + r);
+            int n = x.size();
+
+            // long double reference, two pass
+            long double sum = 0.0L, sumY = 0.0L;
+            for (int i = 0; i < n; i++)
+            {
+                sum += x[i];
+                sumY += y[i];
+            }
+            long double mean = sum / n, meanY = sumY / n;
+            long double squares = 0.0L, absolute = 0.0L, cross = 0.0L, squaresY = 0.0L;
+            for (int i = 0; i < n; i++)
+            {
+                squares += (x[i] - mean) * (x[i] - mean);
+                squaresY += (y[i] - meanY) * (y[i] - meanY);
+                cross += (x[i] - mean) * (y[i] - meanY);
+                absolute += std::fabs(x[i] - mean);
+            }
+            double refStdev = n > 1 ? static_cast<double>(std::sqrt(squares / (n - 1))) : 0.0;
+            double refPcc = (n > 1 && squares > 0 && squaresY > 0)
+                          ? static_cast<double>(cross / std::sqrt(squares * squaresY)) : 0.0;
+
+            double results[3][5];
+            for (int l = 0; l < levelCount; l++)
+            {
+                statistics::setSimdLevel(levels[l]);
+                statistics::DescriptiveStats stats;
+                statistics::calculateDescriptiveStats(x, stats);
+                results[l][0] = statistics::calculateSum(x);
+                results[l][1] = stats.mean;
+                results[l][2] = stats.stdev;
+                results[l][3] = stats.mad;
+                results[l][4] = statistics::calculatesPCC(x, y);
+
+                // the separate functions must agree with the fused one; they take the
+                // mean as a float, which near 10000 is off by up to 5e-4, so the
+                // offset range is left out
+                if (lows[r] < 1000.0f)
+                {
+                    allClose = allClose && closeRelative(statistics::calculateMean(x), stats.mean, relativeTolerance)
+                                        && closeRelative(statistics::calculateStandardDeviation(x), stats.stdev, relativeTolerance)
+                                        && closeRelative(statistics::calculateMAD(x), stats.mad, relativeTolerance);
+                }
+            }
+
+            double reference[] = {static_cast<double>(sum), static_cast<double>(mean), refStdev,
+                                  static_cast<double>(absolute / n), refPcc};
+            for (int l = 0; l < levelCount; l++)
+            {
+                for (int k = 0; k < 5; k++)
+                {
+                    double against[] = {results[0][k], reference[k]};
+                    for (int a = 0; a < 2; a++)
+                    {
+                        double diff = std::fabs(results[l][k] - against[a]);
+                        if (k == 4)
+                        {
+                            worstPcc = diff > worstPcc ? diff : worstPcc;
+                            allClose = allClose && diff <= pccTolerance;
+                        }
+                        else
+                        {
+                            double scale = std::fabs(against[a]) > 0.0 ? std::fabs(against[a]) : 1.0;
+                            worstRelative = diff / scale > worstRelative ? diff / scale : worstRelative;
+                            allClose = allClose && closeRelative(results[l][k], against[a], relativeTolerance);
+                        }
+                        compared++;
+                    }
+                }
+            }
+        }
+    }
+
+    cout << "  " << compared << " comparisons, worst relative difference " << worstRelative
+         << ", worst sPCC difference " << worstPcc << endl;
+    check(allClose, "every level within 1e-6 relative (sPCC 1e-6 absolute)");
+
+    cout << endl;
+}
+
+void testViews()
+{
+    cout << "3. Testing Strided Views Against Spans:" << endl;
+    cout << "---------------------------------------" << endl;
+
+    const int n = 4464;
+    Vector<float> x;
+    Vector<float> y;
+    fillData(x, n, 0.0f, 60.0f, 11u);
+    fillData(y, n, -5.0f, 45.0f, 12u);
+
+    // the same values as an array of structs, interleaved floats and a converted copy
+    Vector<Reading> readings;
+    Vector<float> interleaved;
+    Vector<float> xKmh;
+    for (int i = 0; i < n; i++)
+    {
+        Reading reading = {x[i], y[i]};
+        readings.push_back(reading);
+        interleaved.push_back(x[i]);
+        interleaved.push_back(y[i]);
+        xKmh.push_back(x[i] * 3.6f);
+    }
+
+    statistics::DescriptiveStats expected;
+    statistics::calculateDescriptiveStats(x.begin(), n, expected);
+    float expectedPcc = statistics::calculatesPCC(x.begin(), y.begin(), n);
+
+    // a contiguous view without projection is handed to the span kernels, so it matches exactly
+    statistics::DescriptiveStats stats;
+    statistics::calculateDescriptiveStats(statistics::makeView(x.begin(), n), stats);
+    check(stats.count == n && stats.mean == expected.mean && stats.stdev == expected.stdev &&
+          stats.mad == expected.mad, "contiguous view gives the span results");
+
+    auto firstOf = [](const Reading& reading) { return reading.first; };
+    auto secondOf = [](const Reading& reading) { return reading.second; };
+    auto fieldView = statistics::makeView(readings.begin(), n, firstOf);
+    statistics::calculateDescriptiveStats(fieldView, stats);
+    check(stats.count == n && closeRelative(stats.mean, expected.mean, relativeTolerance) &&
+          closeRelative(stats.stdev, expected.stdev, relativeTolerance) &&
+          closeRelative(stats.mad, expected.mad, relativeTolerance), "projected field of structs");
+    check(closeRelative(statistics::calculateSum(fieldView), statistics::calculateSum(x), relativeTolerance) &&
+          closeRelative(statistics::calculateMean(fieldView), expected.mean, relativeTolerance) &&
+          closeRelative(statistics::calculateStandardDeviation(fieldView, expected.mean), expected.stdev,
+                        relativeTolerance) &&
+          closeRelative(statistics::calculateMAD(fieldView, expected.mean), expected.mad, relativeTolerance),
+          "separate reductions of a projected field");
+    check(std::fabs(statistics::calculatesPCC(fieldView, statistics::makeView(readings.begin(), n, secondOf))
+                    - expectedPcc) <= pccTolerance, "sPCC of two projected fields");
+
+    auto stridedX = statistics::makeView(interleaved.begin(), n, 2);
+    auto stridedY = statistics::makeView(interleaved.begin() + 1, n, 2);
+    statistics::calculateDescriptiveStats(stridedX, stats);
+    check(closeRelative(stats.mean, expected.mean, relativeTolerance) &&
+          closeRelative(stats.stdev, expected.stdev, relativeTolerance) &&
+          closeRelative(stats.mad, expected.mad, relativeTolerance), "stride 2 over interleaved floats");
+    check(std::fabs(statistics::calculatesPCC(stridedX, stridedY) - expectedPcc) <= pccTolerance,
+          "sPCC of two strided views");
+
+    // converting as the values are read gives the same floats as converting a copy
+    auto toKmh = [](float mps) { return mps * 3.6f; };
+    statistics::DescriptiveStats converted;
+    statistics::calculateDescriptiveStats(xKmh.begin(), n, converted);
+    statistics::calculateDescriptiveStats(statistics::makeView(x.begin(), n, toKmh), stats);
+    check(closeRelative(stats.mean, converted.mean, relativeTolerance) &&
+          closeRelative(stats.stdev, converted.stdev, relativeTolerance) &&
+          closeRelative(stats.mad, converted.mad, relativeTolerance), "lazy unit conversion");
+
+    statistics::calculateDescriptiveStats(statistics::makeView(readings.begin(), 0, firstOf), stats);
+    check(stats.count == 0 && stats.mean == 0.0f && statistics::calculateMean(stridedX) != 0.0f &&
+          statistics::calculateMean(statistics::makeView(x.begin(), 0, 2)) == 0.0f, "empty views give zeros");
+
+    cout << endl;
+}
+
+/**
+ * @brief Fills a vector with reproducible pseudo random values
+ * @param data Vector to fill
+ * @param count Number of values
+ * @param low Smallest value
+ * @param high Largest value
+ * @param seed Start of the sequence
+ */
+void fillData(Vector<float>& data, int count, float low, float high, unsigned int seed)
+{
+    unsigned int state = seed;
+    data.reserve(count);
+    for (int i = 0; i < count; i++)
+    {
+        state = state * 1664525u + 1013904223u;
+        float unit = static_cast<float>(state >> 8) / 16777216.0f;
+        data.push_back(low + (high - low) * unit);
+    }
+}
+
+bool closeRelative(double actual, double expected, double tolerance)
+{
+    double scale = std::fabs(expected) > 0.0 ? std::fabs(expected) : 1.0;
+    return std::fabs(actual - expected) <= tolerance * scale;
+}
+
+void check(bool condition, const char* description)
+{
+    cout << (condition ? "  PASS: " : "  FAIL: ") << description << endl;
+    if (!condition)
+    {
+        failures++;
+    }
+}
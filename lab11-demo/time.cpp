@@ -1,14 +1,15 @@
 #include "time.h"
+#include "fastParse.h"
 #include <sstream>
 #include <iomanip> // what is this for?
 // This is for manipulating the output format, such as setting the width and fill characters.
 
 Time::Time() : hour(0), min(0), sec(0) {}
 
-Time::Time(const std::string & timeStr){
-    std::stringstream ss(timeStr);
-    char sep;
-    ss >> hour >> sep >> min >> sep >> sec;
+Time::Time(const std::string & timeStr) : Time(timeStr.data(), timeStr.data() + timeStr.size()) {}
+
+Time::Time(const char * first, const char * last) : hour(0), min(0), sec(0) {
+    fastParse::parseTime(first, last, hour, min, sec);
 }
 
 int Time::getHour() const { return hour; }
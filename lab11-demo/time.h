@@ -23,10 +23,17 @@ public:
 
      /**
      * @brief Constructor to initialize from time string
-     * @param timeStr Time string in format "HH:MM:SS"
+     * @param timeStr Time string in format "HH:MM:SS" or "HH:MM"
      */
     Time(const std::string & timeStr);
 
+     /**
+     * @brief Constructor to initialize from a character range
+     * @param first First character of a "HH:MM" or "HH:MM:SS" time
+     * @param last One past the last character
+     */
+    Time(const char * first, const char * last);
+
     /**
      * @brief Gets the hour component
      * @return Hour value (0-23)
@@ -0,0 +1,35 @@
+/**
+ * @file timestamp.cpp
+ * @brief Conversions between Timestamp and the Date and Time classes
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ */
+
+#include "timestamp.h"
+#include "weatherRecord.h"
+
+// The field layout and the ordering are checked at compile time
+static_assert(sizeof(Timestamp) == 8, "Timestamp must stay one 64 bit value");
+static_assert(Timestamp(2015, 3, 1, 9, 30).getYear() == 2015 &&
+              Timestamp(2015, 3, 1, 9, 30).getMonth() == 3 &&
+              Timestamp(2015, 3, 1, 9, 30).getDay() == 1 &&
+              Timestamp(2015, 3, 1, 9, 30).getHour() == 9 &&
+              Timestamp(2015, 3, 1, 9, 30).getMin() == 30, "fields must round trip");
+static_assert(Timestamp(2014, 12, 31, 23, 50) < Timestamp(2015, 1, 1) &&
+              Timestamp(2015, 1, 31, 23, 50) < Timestamp(2015, 2, 1), "packed order must be date order");
+
+// A record is the Timestamp and three floats, padded to the Timestamp's 8 byte alignment
+static_assert(sizeof(WeatherRecord) == 24, "WeatherRecord must stay a Timestamp and three floats");
+
+Timestamp::Timestamp(const Date & date, const Time & time)
+    : Timestamp(date.GetYear(), date.GetMonth(), date.GetDay(), time.getHour(), time.getMin(), time.getSec()) {}
+
+Date Timestamp::toDate() const {
+    return Date(getDay(), getMonth(), getYear());
+}
+
+Time Timestamp::toTime() const {
+    Time time;
+    time.setTime(getHour(), getMin(), getSec());
+    return time;
+}
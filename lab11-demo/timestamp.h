@@ -0,0 +1,111 @@
+#ifndef TIMESTAMP_H
+#define TIMESTAMP_H
+
+#include "date.h"
+#include "time.h"
+#include <cstdint>
+
+/**
+ * @file timestamp.h
+ * @brief Date and time packed into one 64 bit value
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ *
+ * Layout, most significant field first so that comparing the packed values
+ * compares the dates and times:
+ *
+ *   bits 40-55  year
+ *   bits 32-39  month
+ *   bits 24-31  day
+ *   bits 16-23  hour
+ *   bits 8-15   minute
+ *   bits 0-7    second
+ *
+ * This is the layout of the timestamps in the weatherCache snapshots.
+ */
+
+/**
+ * @class Timestamp
+ * @brief A date and time in 8 bytes, ordered and cheap to compare
+ *
+ * Date and Time hold three ints each. A Timestamp holds the same six fields
+ * in one integer, every field is read back with a shift and a mask, and the
+ * comparison operators are single integer compares, so it can be used
+ * directly as a BST or Map key.
+ */
+class Timestamp {
+public:
+    /**
+     * @brief Default constructor, all fields zero
+     */
+    constexpr Timestamp() : packed(0) {}
+
+    /**
+     * @brief Wraps a value made by getPacked
+     * @param value Packed timestamp
+     */
+    constexpr explicit Timestamp(std::uint64_t value) : packed(value) {}
+
+    /**
+     * @brief Packs the individual fields
+     * @param year Year (0-65535)
+     * @param month Month (1-12)
+     * @param day Day (1-31)
+     * @param hour Hour (0-23)
+     * @param min Minute (0-59)
+     * @param sec Second (0-59)
+     */
+    constexpr Timestamp(int year, int month, int day, int hour = 0, int min = 0, int sec = 0)
+        : packed((static_cast<std::uint64_t>(year & 0xFFFF) << 40) |
+                 (static_cast<std::uint64_t>(month & 0xFF) << 32) |
+                 (static_cast<std::uint64_t>(day & 0xFF) << 24) |
+                 (static_cast<std::uint64_t>(hour & 0xFF) << 16) |
+                 (static_cast<std::uint64_t>(min & 0xFF) << 8) |
+                 static_cast<std::uint64_t>(sec & 0xFF)) {}
+
+    /**
+     * @brief Packs a Date and a Time
+     * @param date Date part
+     * @param time Time of day part
+     */
+    Timestamp(const Date & date, const Time & time);
+
+    // Field access, one shift and mask each, usable in constant expressions
+    constexpr int getYear() const { return static_cast<int>((packed >> 40) & 0xFFFF); }
+    constexpr int getMonth() const { return static_cast<int>((packed >> 32) & 0xFF); }
+    constexpr int getDay() const { return static_cast<int>((packed >> 24) & 0xFF); }
+    constexpr int getHour() const { return static_cast<int>((packed >> 16) & 0xFF); }
+    constexpr int getMin() const { return static_cast<int>((packed >> 8) & 0xFF); }
+    constexpr int getSec() const { return static_cast<int>(packed & 0xFF); }
+
+    /**
+     * @brief Gets the packed value, e.g. for writing to a file
+     * @return year << 40 | month << 32 | day << 24 | hour << 16 | min << 8 | sec
+     */
+    constexpr std::uint64_t getPacked() const { return packed; }
+
+    /**
+     * @brief Builds the date part
+     * @return Date with the day, month and year of this timestamp
+     */
+    Date toDate() const;
+
+    /**
+     * @brief Builds the time of day part
+     * @return Time with the hour, minute and second of this timestamp
+     */
+    Time toTime() const;
+
+    // Total order: earlier timestamps compare less
+    constexpr bool operator==(const Timestamp & other) const { return packed == other.packed; }
+    constexpr bool operator!=(const Timestamp & other) const { return packed != other.packed; }
+    constexpr bool operator<(const Timestamp & other) const { return packed < other.packed; }
+    constexpr bool operator<=(const Timestamp & other) const { return packed <= other.packed; }
+    constexpr bool operator>(const Timestamp & other) const { return packed > other.packed; }
+    constexpr bool operator>=(const Timestamp & other) const { return packed >= other.packed; }
+
+private:
+    std::uint64_t packed;   // Fields laid out as described at the top of this file
+};
+
+#endif // TIMESTAMP_H
@@ -2,6 +2,12 @@
 #define VECTOR_H
 
 #include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <type_traits>
 
 /**
  * @class Vector
@@ -9,6 +15,11 @@
  * 
  * A custom vector class that provides dynamic array functionality without using STL containers
  * Since it is dynamic array it supports automatic resizing and basic array operations.alignas
+ *
+ * Storage is raw memory: an element is only constructed (placement new) when it is
+ * added and destroyed when it is removed, so an empty Vector of 10 never builds 10
+ * default T objects. For trivially copyable T, growing uses realloc and copying
+ * uses memcpy instead of constructing element by element.
  * 
  * @author Dhruv Goswami
  * @version 1.0
@@ -30,6 +41,12 @@ public:
      */
     Vector(const Vector & other);
 
+    /**
+     * @brief Move constructor, takes over the storage of other
+     * @param other the vector to move from, left empty
+     */
+    Vector(Vector && other) noexcept;
+
     /**
      * @brief Destructor
      */
@@ -42,18 +59,66 @@ public:
      */
     Vector & operator=(const Vector & other);
 
+    /**
+     * @brief Move assignment operator, takes over the storage of other
+     * @param other the vector to move from, left empty
+     * @return reference to the current vector
+     */
+    Vector & operator=(Vector && other) noexcept;
+
     /**
      * @brief Returns the number of elements in the vector
      * @return the current size of the vector
      */
     int size() const;
 
+    /**
+     * @brief Makes room for at least newCapacity elements without changing the size
+     * @param newCapacity the minimum capacity after the call
+     */
+    void reserve(int newCapacity);
+
+    /**
+     * @brief Releases unused capacity so it matches the size
+     */
+    void shrink_to_fit();
+
     /**
      * @brief Adds a new element to the end of the vector
      * @param value the value to add
      */
     void push_back(const T & value);
 
+    /**
+     * @brief Adds a new element to the end of the vector by moving it
+     * @param value the value to move in
+     */
+    void push_back(T && value);
+
+    /**
+     * @brief Builds a new element at the end of the vector from constructor arguments
+     * @param args arguments passed on to the constructor of T
+     */
+    template <class... Args>
+    void emplace_back(Args &&... args);
+
+    /**
+     * @brief Adds copies of n elements to the end of the vector, growing the storage at most once
+     * @param first the first element to copy, may point into this vector
+     * @param n the number of elements to copy
+     */
+    void append(const T * first, int n);
+
+    /**
+     * @brief Removes the last element
+     */
+    void pop_back();
+
+    /**
+     * @brief Removes every element, the capacity is kept
+     */
+    void clear();
+
     /**
      * @brief Accesses an element at a specific index
      * @param index the index of the element to access
@@ -68,61 +133,201 @@ public:
      */
     const T & operator[](int index) const;
 
+    /**
+     * @brief Gets the first element for unchecked, contiguous access
+     * @return pointer to the first element, elements run up to end()
+     */
+    T * begin();
+
+    /**
+     * @brief Gets the first element for unchecked, contiguous access (const version)
+     * @return pointer to the first element, elements run up to end()
+     */
+    const T * begin() const;
+
+    /**
+     * @brief Gets one past the last element
+     * @return pointer one past the last element
+     */
+    T * end();
+
+    /**
+     * @brief Gets one past the last element (const version)
+     * @return pointer one past the last element
+     */
+    const T * end() const;
+
 private:
-    T * data;       // Pointer to the array that holds the elements
+    T * data;       // Pointer to the raw storage, only the first count slots hold elements
     int count;      // Current number of elements in the vector
     int capacity;   // Max capacity before resizing
 
+    // Elements can be moved with memcpy and never need a destructor call
+    typedef std::integral_constant<bool, std::is_trivially_copyable<T>::value> isTrivial;
+
+    static_assert(alignof(T) <= alignof(std::max_align_t), "Vector storage comes from malloc");
+
     void resize();
+    void reallocate(int newCapacity);
+    void reallocate(int newCapacity, std::true_type);
+    void reallocate(int newCapacity, std::false_type);
+    template <class... Args>
+    void growAndEmplace(std::true_type, Args &&... args);
+    template <class... Args>
+    void growAndEmplace(std::false_type, Args &&... args);
+    void copyFrom(const Vector & other);
+    static void copyElements(T * target, const T * source, int n);
+    void destroyElements();
+
+    static T * allocate(int slots);
 };
 
 // Implementation
 
 template <class T>
-Vector<T>::Vector(int size) : count(0), capacity(size) {
-    data = new T[capacity];
+T * Vector<T>::allocate(int slots) {
+    if (slots <= 0) {
+        return nullptr;
+    }
+    T * memory = static_cast<T *>(std::malloc(static_cast<std::size_t>(slots) * sizeof(T)));
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}// Allocates raw storage for slots elements, nothing is constructed
+
+template <class T>
+Vector<T>::Vector(int size) : data(allocate(size)), count(0), capacity(size > 0 ? size : 0) {
 }// Constructor
 
 
 template <class T>
-Vector<T>::Vector(const Vector<T> & other) : count(other.count), capacity(other.capacity) {
-    data = new T[capacity];
-    for (int i = 0; i < count; i++) {
-        data[i] = other.data[i];
-    }
+Vector<T>::Vector(const Vector<T> & other) : data(allocate(other.capacity)), count(0), capacity(other.capacity) {
+    copyFrom(other);
 }// Copy constructor
 
+template <class T>
+Vector<T>::Vector(Vector<T> && other) noexcept : data(other.data), count(other.count), capacity(other.capacity) {
+    other.data = nullptr;
+    other.count = 0;
+    other.capacity = 0;
+}// Move constructor
+
 template <class T> 
 Vector<T>::~Vector() {
-    delete[] data;
+    destroyElements();
+    std::free(data);
 }// Destructor
 
 template <class T>
 Vector<T> & Vector<T>::operator=(const Vector<T> & other) {
     if (this != &other) {
-        delete[] data;
-        count = other.count;
-        capacity = other.capacity;
-        data = new T[capacity];
-        for (int i = 0; i < count; i++) {
-            data[i] = other.data[i];
+        destroyElements();
+        if (capacity < other.count) {
+            std::free(data);
+            data = allocate(other.capacity);
+            capacity = other.capacity;
         }
+        copyFrom(other);
     }
     return *this;
 }// Assignment operator
 
+template <class T>
+Vector<T> & Vector<T>::operator=(Vector<T> && other) noexcept {
+    if (this != &other) {
+        destroyElements();
+        std::free(data);
+        data = other.data;
+        count = other.count;
+        capacity = other.capacity;
+        other.data = nullptr;
+        other.count = 0;
+        other.capacity = 0;
+    }
+    return *this;
+}// Move assignment operator
+
 template <class T>
 int Vector<T>::size() const {
     return count;
 }// Returns the number of elements in the vector
 
+template <class T>
+void Vector<T>::reserve(int newCapacity) {
+    if (newCapacity > capacity) {
+        reallocate(newCapacity);
+    }
+}// Grows the storage to hold at least newCapacity elements
+
+template <class T>
+void Vector<T>::shrink_to_fit() {
+    if (count < capacity) {
+        reallocate(count);
+    }
+}// Releases unused capacity
+
 template <class T>
 void Vector<T>::push_back(const T & value) {
+    emplace_back(value);
+}// Adds a new element to the end of the vector
+
+template <class T>
+void Vector<T>::push_back(T && value) {
+    emplace_back(std::move(value));
+}// Moves a new element to the end of the vector
+
+template <class T>
+template <class... Args>
+void Vector<T>::emplace_back(Args &&... args) {
     if (count == capacity) {
-        resize();
+        growAndEmplace(isTrivial(), std::forward<Args>(args)...);
+        return;
     }
-    data[count++] = value;
-}// Adds a new element to the end of the vector
+    new (data + count) T(std::forward<Args>(args)...);
+    count++;
+}// Builds a new element in place at the end of the vector
+
+template <class T>
+void Vector<T>::append(const T * first, int n) {
+    if (n <= 0) {
+        return;
+    }
+    if (count + n <= capacity) {
+        copyElements(data + count, first, n);
+        count += n;
+        return;
+    }
+    // first may point into this vector, so the copies are made before the old storage is freed
+    int newCapacity = (capacity * 2 > count + n) ? capacity * 2 : count + n;
+    T * newData = allocate(newCapacity);
+    copyElements(newData + count, first, n);
+    if (isTrivial::value) {
+        if (count > 0) {
+            std::memcpy(static_cast<void *>(newData), data, static_cast<std::size_t>(count) * sizeof(T));
+        }
+    } else {
+        for (int i = 0; i < count; i++) {
+            new (newData + i) T(std::move(data[i]));
+            data[i].~T();
+        }
+    }
+    std::free(data);
+    data = newData;
+    capacity = newCapacity;
+    count += n;
+}// Copies a range of elements to the end of the vector
+
+template <class T>
+void Vector<T>::pop_back() {
+    assert(count > 0);
+    data[--count].~T();
+}// Removes the last element
+
+template <class T>
+void Vector<T>::clear() {
+    destroyElements();
+}// Removes every element
 
 template <class T>
 T & Vector<T>::operator[](int index) {
@@ -136,15 +341,118 @@ const T & Vector<T>::operator[](int index) const {
     return data[index];
 }// Accesses an element at a specific index (const version)
 
+template <class T>
+T * Vector<T>::begin() {
+    return data;
+}// Gets the first element
+
+template <class T>
+const T * Vector<T>::begin() const {
+    return data;
+}// Gets the first element (const version)
+
+template <class T>
+T * Vector<T>::end() {
+    return data + count;
+}// Gets one past the last element
+
+template <class T>
+const T * Vector<T>::end() const {
+    return data + count;
+}// Gets one past the last element (const version)
+
 template <class T>
 void Vector<T>::resize() {
-    capacity *= 2;
-    T * newData = new T[capacity];
+    reallocate(capacity > 0 ? capacity * 2 : 10);
+}// Resizes the vector to double its current capacity
+
+template <class T>
+void Vector<T>::reallocate(int newCapacity) {
+    reallocate(newCapacity, isTrivial());
+}// Moves the elements into storage of newCapacity elements
+
+template <class T>
+void Vector<T>::reallocate(int newCapacity, std::true_type) {
+    if (newCapacity <= 0) {
+        std::free(data);
+        data = nullptr;
+        capacity = 0;
+        return;
+    }
+    T * newData = static_cast<T *>(std::realloc(data, static_cast<std::size_t>(newCapacity) * sizeof(T)));
+    if (newData == nullptr) {
+        throw std::bad_alloc();
+    }
+    data = newData;
+    capacity = newCapacity;
+}// Trivially copyable elements: realloc copies the bytes (or grows in place)
+
+template <class T>
+void Vector<T>::reallocate(int newCapacity, std::false_type) {
+    T * newData = allocate(newCapacity);
     for (int i = 0; i < count; i++) {
-        newData[i] = data[i];
+        new (newData + i) T(std::move(data[i]));
+        data[i].~T();
     }
-    delete[] data;
+    std::free(data);
     data = newData;
-}// Resizes the vector to double its current capacity
+    capacity = newCapacity;
+}// Other elements are move constructed into the new storage one by one
+
+template <class T>
+template <class... Args>
+void Vector<T>::growAndEmplace(std::true_type, Args &&... args) {
+    // args may refer to an element, build the value before realloc frees it
+    T value(std::forward<Args>(args)...);
+    resize();
+    std::memcpy(static_cast<void *>(data + count), &value, sizeof(T));
+    count++;
+}// Adds an element when the storage is full (trivially copyable T)
+
+template <class T>
+template <class... Args>
+void Vector<T>::growAndEmplace(std::false_type, Args &&... args) {
+    // the new element is built while the old storage, which args may refer to, is still alive
+    int newCapacity = capacity > 0 ? capacity * 2 : 10;
+    T * newData = allocate(newCapacity);
+    new (newData + count) T(std::forward<Args>(args)...);
+    for (int i = 0; i < count; i++) {
+        new (newData + i) T(std::move(data[i]));
+        data[i].~T();
+    }
+    std::free(data);
+    data = newData;
+    capacity = newCapacity;
+    count++;
+}// Adds an element when the storage is full
+
+template <class T>
+void Vector<T>::copyFrom(const Vector<T> & other) {
+    copyElements(data, other.data, other.count);
+    count = other.count;
+}// Copy constructs the elements of other into empty storage that is large enough
+
+template <class T>
+void Vector<T>::copyElements(T * target, const T * source, int n) {
+    if (isTrivial::value) {
+        if (n > 0) {
+            std::memcpy(static_cast<void *>(target), source, static_cast<std::size_t>(n) * sizeof(T));
+        }
+    } else {
+        for (int i = 0; i < n; i++) {
+            new (target + i) T(source[i]);
+        }
+    }
+}// Copy constructs n elements into raw storage that does not overlap them
+
+template <class T>
+void Vector<T>::destroyElements() {
+    if (!std::is_trivially_destructible<T>::value) {
+        for (int i = 0; i < count; i++) {
+            data[i].~T();
+        }
+    }
+    count = 0;
+}// Destroys every element, the storage is kept
 
 #endif
\ No newline at end of file
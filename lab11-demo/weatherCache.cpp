@@ -0,0 +1,225 @@
+/**
+ * @file weatherCache.cpp
+ * @brief Implementation of the binary columnar record snapshots
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ */
+
+#include "weatherCache.h"
+#include "mappedFile.h"
+#include <fstream>
+#include <cstring>
+#include <cstdio>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace weatherCache {
+
+    namespace {
+        const char cacheMagic[8] = { 'W', 'X', 'C', 'A', 'C', 'H', 'E', '\0' };
+
+        struct CacheHeader {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t recordCount;
+            std::uint64_t sourceSize;
+            std::int64_t sourceMtime;
+        };
+
+        // Columns of a mapped snapshot, pointing into the mapping
+        struct SnapshotColumns {
+            const std::uint64_t * timestamps;
+            const float * wind;
+            const float * temperature;
+            const float * solar;
+            int count;
+        };
+
+        bool openSnapshot(const std::string & sourceFile, MappedFile & file, SnapshotColumns & columns) {
+            SourceStamp stamp;
+            if (!readSourceStamp(sourceFile, stamp)) {
+                return false;
+            }
+
+            if (!file.open(cacheFilename(sourceFile)) || file.size() < sizeof(CacheHeader)) {
+                return false;
+            }
+
+            CacheHeader header;
+            std::memcpy(&header, file.begin(), sizeof(header));
+            if (std::memcmp(header.magic, cacheMagic, sizeof(cacheMagic)) != 0 ||
+                header.version != cacheVersion ||
+                header.sourceSize != stamp.size ||
+                header.sourceMtime != stamp.mtime) {
+                return false;
+            }
+
+            // a truncated snapshot has the right header but the wrong length
+            std::size_t n = header.recordCount;
+            if (file.size() != sizeof(CacheHeader) + n * (sizeof(std::uint64_t) + 3 * sizeof(float))) {
+                return false;
+            }
+
+            // the mapping is page aligned and the header is 32 bytes, so every column is aligned
+            columns.timestamps = reinterpret_cast<const std::uint64_t *>(file.begin() + sizeof(CacheHeader));
+            columns.wind = reinterpret_cast<const float *>(columns.timestamps + n);
+            columns.temperature = columns.wind + n;
+            columns.solar = columns.temperature + n;
+            columns.count = static_cast<int>(n);
+            return true;
+        }
+
+        int processId() {
+#ifdef _WIN32
+            return _getpid();
+#else
+            return static_cast<int>(getpid());
+#endif
+        }
+
+        // Replaces target with source in one step, so a reader sees the old or the new file
+        bool replaceFile(const std::string & source, const std::string & target) {
+#ifdef _WIN32
+            return MoveFileExA(source.c_str(), target.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+            return std::rename(source.c_str(), target.c_str()) == 0;
+#endif
+        }
+
+        bool writeSnapshot(const std::string & sourceFile, const SourceStamp & stamp, const std::uint64_t * timestamps,
+                           const float * wind, const float * temperature, const float * solar, int n) {
+            CacheHeader header;
+            std::memcpy(header.magic, cacheMagic, sizeof(cacheMagic));
+            header.version = cacheVersion;
+            header.sourceSize = stamp.size;
+            header.sourceMtime = stamp.mtime;
+            header.recordCount = static_cast<std::uint32_t>(n);
+
+            // Another run may have the snapshot mapped: truncating it in place
+            // would fault that run or show it a half written file, so the new
+            // snapshot is written beside it and renamed over it when complete
+            std::string snapshotFile = cacheFilename(sourceFile);
+            std::string tempFile = snapshotFile + "." + std::to_string(processId()) + ".tmp";
+            std::ofstream out(tempFile, std::ios::binary | std::ios::trunc);
+            if (!out) {
+                return false;
+            }
+            out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            out.write(reinterpret_cast<const char *>(timestamps), n * sizeof(std::uint64_t));
+            out.write(reinterpret_cast<const char *>(wind), n * sizeof(float));
+            out.write(reinterpret_cast<const char *>(temperature), n * sizeof(float));
+            out.write(reinterpret_cast<const char *>(solar), n * sizeof(float));
+            out.close();
+
+            if (!out || !replaceFile(tempFile, snapshotFile)) {
+                std::remove(tempFile.c_str());
+                return false;
+            }
+            return true;
+        }
+    }
+
+    std::string cacheFilename(const std::string & sourceFile) {
+        return sourceFile + ".cache";
+    }
+
+    bool readSourceStamp(const std::string & sourceFile, SourceStamp & stamp) {
+        struct stat info;
+        if (stat(sourceFile.c_str(), &info) != 0) {
+            return false;
+        }
+        stamp.size = static_cast<std::uint64_t>(info.st_size);
+        stamp.mtime = static_cast<std::int64_t>(info.st_mtime);
+        return true;
+    }
+
+    std::uint64_t packTimestamp(const Date & date, const Time & time) {
+        return Timestamp(date, time).getPacked();
+    }
+
+    void unpackTimestamp(std::uint64_t packed, Date & date, Time & time) {
+        Timestamp timestamp(packed);
+        date = timestamp.toDate();
+        time = timestamp.toTime();
+    }
+
+    bool readCache(const std::string & sourceFile, Vector<WeatherRecord> & records) {
+        MappedFile file;
+        SnapshotColumns columns;
+        if (!openSnapshot(sourceFile, file, columns)) {
+            return false;
+        }
+
+        records.reserve(records.size() + columns.count);
+        for (int i = 0; i < columns.count; i++) {
+            records.emplace_back(Timestamp(columns.timestamps[i]), columns.wind[i], columns.temperature[i],
+                                 columns.solar[i]);
+        }
+        return true;
+    }
+
+    bool readCache(const std::string & sourceFile, WeatherTable & table) {
+        MappedFile file;
+        SnapshotColumns columns;
+        if (!openSnapshot(sourceFile, file, columns)) {
+            return false;
+        }
+
+        // same layout on disk and in memory, every column is one memcpy
+        table.append(columns.timestamps, columns.wind, columns.temperature, columns.solar, columns.count);
+        return true;
+    }
+
+    bool readCache(const std::string & sourceFile, WeatherSummary & summary) {
+        MappedFile file;
+        SnapshotColumns columns;
+        if (!openSnapshot(sourceFile, file, columns)) {
+            return false;
+        }
+
+        for (int i = 0; i < columns.count; i++) {
+            // the loaders no longer keep rows without a month, but a damaged
+            // snapshot could still hold one
+            Timestamp when(columns.timestamps[i]);
+            if (when.getMonth() >= 1 && when.getMonth() <= 12) {
+                summary.add(when, columns.wind[i], columns.temperature[i], columns.solar[i]);
+            }
+        }
+        return true;
+    }
+
+    bool writeCache(const std::string & sourceFile, const SourceStamp & stamp,
+                    const Vector<WeatherRecord> & records, int first) {
+        int n = records.size() - first;
+
+        // split the records into one array per column
+        std::uint64_t * timestamps = new std::uint64_t[n];
+        float * columns = new float[3 * n];
+        for (int i = 0; i < n; i++) {
+            const WeatherRecord & record = records[first + i];
+            timestamps[i] = record.getTimestamp().getPacked();
+            columns[i] = record.getWindSpeed();
+            columns[n + i] = record.getTemperature();
+            columns[2 * n + i] = record.getSolarRadiation();
+        }
+
+        bool written = writeSnapshot(sourceFile, stamp, timestamps, columns, columns + n, columns + 2 * n, n);
+
+        delete[] timestamps;
+        delete[] columns;
+        return written;
+    }
+
+    bool writeCache(const std::string & sourceFile, const SourceStamp & stamp,
+                    const WeatherTable & table, int first) {
+        return writeSnapshot(sourceFile, stamp, table.timestamps() + first, table.windSpeeds() + first,
+                             table.temperatures() + first, table.solarRadiation() + first, table.size() - first);
+    }
+
+} // namespace weatherCache
@@ -0,0 +1,140 @@
+#ifndef WEATHER_CACHE_H
+#define WEATHER_CACHE_H
+
+#include "vector.h"
+#include "weatherRecord.h"
+#include "weatherTable.h"
+#include "weatherSummary.h"
+#include <string>
+#include <cstdint>
+
+/**
+ * @file weatherCache.h
+ * @brief Binary columnar snapshot of the records loaded from one CSV file
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ *
+ * The snapshot is stored next to the source as "<source>.cache":
+ *
+ *   offset 0   char[8]      magic "WXCACHE"
+ *   offset 8   uint32       format version (cacheVersion)
+ *   offset 12  uint32       number of records n
+ *   offset 16  uint64       size of the source CSV in bytes
+ *   offset 24  int64        modification time of the source CSV
+ *   offset 32  uint64[n]    packed timestamps
+ *   then       float[n]     wind speed (m/s)
+ *   then       float[n]     temperature (degrees C)
+ *   then       float[n]     solar radiation (W/m2)
+ *
+ * Values are in native byte order, the cache is only meant for the machine
+ * that wrote it. A snapshot is used only when the version, the source size
+ * and mtime and the file length all match, otherwise the CSV is parsed again.
+ * A snapshot is written to "<source>.cache.<pid>.tmp" and renamed over the
+ * old one, so runs reading it at the same time never see a partial file.
+ */
+
+/**
+ * @namespace weatherCache
+ * @brief Reading and writing of the binary record snapshots
+ */
+namespace weatherCache {
+    /// Bumped whenever the on-disk layout, or which rows a snapshot keeps, changes
+    /// (2: rows with an unparseable date are no longer loaded)
+    const std::uint32_t cacheVersion = 2;
+
+    /**
+     * @struct SourceStamp
+     * @brief Size and modification time of a source CSV, as kept in its snapshot header
+     */
+    struct SourceStamp {
+        std::uint64_t size = 0;   // Size in bytes
+        std::int64_t mtime = 0;   // Modification time in seconds
+    };
+
+    /**
+     * @brief Reads the size and modification time of a source file
+     *
+     * Taken before the file is parsed and handed to writeCache, so a CSV that
+     * changes while it is parsed leaves a snapshot that no longer matches it.
+     *
+     * @param sourceFile Path of the CSV file
+     * @param stamp Output for the size and mtime
+     * @return false if the file cannot be read
+     */
+    bool readSourceStamp(const std::string & sourceFile, SourceStamp & stamp);
+
+    /**
+     * @brief Gets the snapshot path for a source file
+     * @param sourceFile Path of the CSV file
+     * @return Path of its snapshot
+     */
+    std::string cacheFilename(const std::string & sourceFile);
+
+    /**
+     * @brief Packs a date and time into one ordered 64 bit value, same as Timestamp
+     * @param date Date to pack
+     * @param time Time to pack
+     * @return year << 40 | month << 32 | day << 24 | hour << 16 | min << 8 | sec
+     */
+    std::uint64_t packTimestamp(const Date & date, const Time & time);
+
+    /**
+     * @brief Unpacks a value made by packTimestamp
+     * @param packed Packed timestamp
+     * @param date Output date
+     * @param time Output time
+     */
+    void unpackTimestamp(std::uint64_t packed, Date & date, Time & time);
+
+    /**
+     * @brief Loads the snapshot of a source file if it is still up to date
+     * @param sourceFile Path of the CSV file
+     * @param records Vector to append the cached records to
+     * @return true if a valid snapshot was found and loaded
+     */
+    bool readCache(const std::string & sourceFile, Vector<WeatherRecord> & records);
+
+    /**
+     * @brief Loads the snapshot of a source file into a table if it is still up to date
+     * @param sourceFile Path of the CSV file
+     * @param table Table to append the cached rows to
+     * @return true if a valid snapshot was found and loaded
+     */
+    bool readCache(const std::string & sourceFile, WeatherTable & table);
+
+    /**
+     * @brief Streams the snapshot of a source file into a summary if it is still up to date
+     *
+     * The rows are read straight from the mapping, nothing the size of the
+     * file is allocated. There is no matching writeCache: a summary keeps no rows.
+     *
+     * @param sourceFile Path of the CSV file
+     * @param summary Summary to add the cached rows to
+     * @return true if a valid snapshot was found and loaded
+     */
+    bool readCache(const std::string & sourceFile, WeatherSummary & summary);
+
+    /**
+     * @brief Writes the snapshot of a source file
+     * @param sourceFile Path of the CSV file the records came from
+     * @param stamp Stamp of the source read before it was parsed
+     * @param records Records loaded from that file
+     * @param first Index of the first record of that file in records
+     * @return true if the snapshot was written
+     */
+    bool writeCache(const std::string & sourceFile, const SourceStamp & stamp,
+                    const Vector<WeatherRecord> & records, int first = 0);
+
+    /**
+     * @brief Writes the snapshot of a source file straight from the table columns
+     * @param sourceFile Path of the CSV file the rows came from
+     * @param stamp Stamp of the source read before it was parsed
+     * @param table Rows loaded from that file
+     * @param first Index of the first row of that file in table
+     * @return true if the snapshot was written
+     */
+    bool writeCache(const std::string & sourceFile, const SourceStamp & stamp,
+                    const WeatherTable & table, int first = 0);
+}
+
+#endif // WEATHER_CACHE_H
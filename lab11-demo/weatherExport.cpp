@@ -0,0 +1,31 @@
+/**
+ * @file weatherExport.cpp
+ * @brief Non-template parts of the WindTempSolar.csv export
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ */
+
+#include "weatherExport.h"
+
+namespace weatherExport {
+
+    std::string getMonthName(int month) {
+        const std::string monthNames[] = {
+            "January", "February", "March", "April", "May", "June",
+            "July", "August", "September", "October", "November", "December"
+        };
+        return monthNames[month - 1];
+    }
+
+    std::string yearFilename(int year) {
+        return "WindTempSolar_" + std::to_string(year) + ".csv";
+    }
+
+    void writeMonth(std::ostream& out, const MonthStats& stats) {
+        out << getMonthName(stats.month) << ","
+            << stats.wind.mean << "(" << stats.wind.stdev << ", " << stats.wind.mad << "),"
+            << stats.temp.mean << "(" << stats.temp.stdev << ", " << stats.temp.mad << "),"
+            << stats.solarTotal << std::endl;
+    }
+
+} // namespace weatherExport
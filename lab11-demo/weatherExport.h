@@ -0,0 +1,181 @@
+#ifndef WEATHER_EXPORT_H
+#define WEATHER_EXPORT_H
+
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include "vector.h"
+#include "monthMoments.h"
+
+/**
+ * @file weatherExport.h
+ * @brief Writer for the WindTempSolar.csv yearly export
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ *
+ * The writer only needs the month queries, so the same code (and therefore
+ * the same file) serves the menu, which queries analyzeWeather, and the
+ * streaming mode, which queries a WeatherSummary.
+ */
+
+/**
+ * @namespace weatherExport
+ * @brief CSV export of monthly wind, temperature and solar statistics
+ */
+namespace weatherExport {
+    /// File written by the export
+    const char* const exportFilename = "WindTempSolar.csv";
+
+    /// Column layout of every month line
+    const char* const exportFormat =
+        "Month,Average Wind Speed(stdev, mad),Average Ambient Temperature(stdev, mad),Total Solar Radiation";
+
+    /**
+     * @brief Gets the English name of a month
+     * @param month Month (1-12)
+     * @return "January" to "December"
+     */
+    std::string getMonthName(int month);
+
+    /**
+     * @brief Writes the line of one month: name, wind and temperature mean(stdev, mad), solar total
+     * @param out Stream to write to, set to fixed two decimal output
+     * @param stats Statistics of the month
+     */
+    void writeMonth(std::ostream& out, const MonthStats& stats);
+
+    /**
+     * @brief Writes one year of the export: the year line, then one line per month with data
+     *
+     * Source is analyzeWeather or WeatherSummary, anything with calculateYearStats.
+     * It is called once, so the year's records are read in a single pass instead
+     * of once per month and statistic.
+     *
+     * @param out Stream to write to
+     * @param year Year to export
+     * @param source Statistics to export
+     * @return true if the year had data for at least one month
+     */
+    template <class Source>
+    bool writeYear(std::ostream& out, int year, Source& source);
+
+    /**
+     * @brief Writes the export for one year to a file, replacing it
+     * @param filename File to write
+     * @param year Year to export
+     * @param source Statistics to export
+     * @return false if the file cannot be opened
+     */
+    template <class Source>
+    bool exportYear(const std::string& filename, int year, Source& source);
+
+    /**
+     * @brief Gets the file a year is written to when every year gets its own file
+     * @param year Year
+     * @return e.g. "WindTempSolar_2015.csv"
+     */
+    std::string yearFilename(int year);
+
+    /**
+     * @brief Writes every year with data: the writeYear block of each, in ascending order
+     *
+     * Each month's records belong to exactly one year, so the whole archive is
+     * read once in total.
+     *
+     * @param out Stream to write to
+     * @param source Statistics to export, also needs getAvailableYears
+     * @return Number of years written
+     */
+    template <class Source>
+    int writeAllYears(std::ostream& out, Source& source);
+
+    /**
+     * @brief Writes every year with data to one combined file, replacing it
+     * @param filename File to write
+     * @param source Statistics to export
+     * @return false if the file cannot be opened
+     */
+    template <class Source>
+    bool exportAllYears(const std::string& filename, Source& source);
+
+    /**
+     * @brief Writes every year with data to its own yearFilename file
+     * @param source Statistics to export
+     * @param written Output for the names of the files written, in year order
+     * @return false if a file cannot be opened; the files before it are kept
+     */
+    template <class Source>
+    bool exportEachYear(Source& source, Vector<std::string>& written);
+}
+
+// Implementation
+
+template <class Source>
+bool weatherExport::writeYear(std::ostream& out, int year, Source& source) {
+    Vector<MonthStats> stats;
+    source.calculateYearStats(year, stats);
+
+    out << std::fixed << std::setprecision(2);
+    out << year << std::endl;
+    for (int m = 0; m < stats.size(); m++) {
+        writeMonth(out, stats[m]);
+    }
+
+    if (stats.size() == 0) {
+        out << "No data available for year " << year << std::endl;
+    }
+    return stats.size() > 0;
+}
+
+template <class Source>
+bool weatherExport::exportYear(const std::string& filename, int year, Source& source) {
+    std::ofstream outFile(filename);
+    if (!outFile) {
+        return false;
+    }
+
+    writeYear(outFile, year, source);
+    outFile.close();
+    return true;
+}
+
+template <class Source>
+int weatherExport::writeAllYears(std::ostream& out, Source& source) {
+    Vector<int> years;
+    source.getAvailableYears(years);
+    for (int y = 0; y < years.size(); y++) {
+        writeYear(out, years[y], source);
+    }
+    return years.size();
+}
+
+template <class Source>
+bool weatherExport::exportAllYears(const std::string& filename, Source& source) {
+    std::ofstream outFile(filename);
+    if (!outFile) {
+        return false;
+    }
+
+    writeAllYears(outFile, source);
+    outFile.close();
+    return true;
+}
+
+template <class Source>
+bool weatherExport::exportEachYear(Source& source, Vector<std::string>& written) {
+    written.clear();
+
+    Vector<int> years;
+    source.getAvailableYears(years);
+    for (int y = 0; y < years.size(); y++) {
+        std::string filename = yearFilename(years[y]);
+        if (!exportYear(filename, years[y], source)) {
+            return false;
+        }
+        written.push_back(filename);
+    }
+    return true;
+}
+
+#endif // WEATHER_EXPORT_H
@@ -0,0 +1,30 @@
+/**
+ * @file weatherParameter.cpp
+ * @brief Conversion between parameter names and WeatherParameter
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ */
+
+#include "weatherParameter.h"
+
+bool parseWeatherParameter(const std::string& name, WeatherParameter& parameter) {
+    if (name == "wind") {
+        parameter = WeatherParameter::Wind;
+    } else if (name == "temp") {
+        parameter = WeatherParameter::Temperature;
+    } else if (name == "solar") {
+        parameter = WeatherParameter::Solar;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+const char* getParameterName(WeatherParameter parameter) {
+    switch (parameter) {
+        case WeatherParameter::Wind: return "wind";
+        case WeatherParameter::Temperature: return "temp";
+        case WeatherParameter::Solar: return "solar";
+    }
+    return "wind";
+}
@@ -0,0 +1,43 @@
+#ifndef WEATHER_PARAMETER_H
+#define WEATHER_PARAMETER_H
+
+#include <string>
+
+/**
+ * @file weatherParameter.h
+ * @brief The measured quantities a statistic can be asked for
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ */
+
+/**
+ * @enum WeatherParameter
+ * @brief Wind speed, temperature or solar radiation
+ *
+ * Queries take the enum, so the choice is a switch (or a template argument,
+ * see parameterField.h) instead of string comparisons. The names "wind",
+ * "temp" and "solar" are only read where people type them: the menu and the
+ * batch queries.
+ */
+enum class WeatherParameter {
+    Wind,           ///< Wind speed, reported in km/h
+    Temperature,    ///< Ambient temperature, reported in degrees C
+    Solar           ///< Solar radiation, reported in kWh/m2
+};
+
+/**
+ * @brief Reads a parameter name
+ * @param name "wind", "temp" or "solar"
+ * @param parameter Output for the parameter
+ * @return false for any other name
+ */
+bool parseWeatherParameter(const std::string& name, WeatherParameter& parameter);
+
+/**
+ * @brief Gets the name of a parameter, the inverse of parseWeatherParameter
+ * @param parameter Parameter
+ * @return "wind", "temp" or "solar"
+ */
+const char* getParameterName(WeatherParameter parameter);
+
+#endif // WEATHER_PARAMETER_H
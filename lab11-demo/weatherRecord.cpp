@@ -1,16 +1,23 @@
 #include "WeatherRecord.h"
 
-WeatherRecord::WeatherRecord() : windSpeed(0.0f), temperature(0.0f), solarRadiation(0.0f){}
+WeatherRecord::WeatherRecord() : timestamp(2000, 1, 1), windSpeed(0.0f), temperature(0.0f), solarRadiation(0.0f){}
 
 WeatherRecord::WeatherRecord(const Date & d, const Time & t, float windSpeed, float temp, float solarRadiation) 
-    : date(d), time(t), windSpeed(windSpeed), temperature(temp), solarRadiation(solarRadiation) {}
+    : timestamp(d, t), windSpeed(windSpeed), temperature(temp), solarRadiation(solarRadiation) {}
+
+WeatherRecord::WeatherRecord(Timestamp when, float windSpeed, float temp, float solarRadiation)
+    : timestamp(when), windSpeed(windSpeed), temperature(temp), solarRadiation(solarRadiation) {}
 
 Date WeatherRecord::getDate() const{
-    return date;
+    return timestamp.toDate();
 }
 
 Time WeatherRecord::getTime() const{
-    return time;
+    return timestamp.toTime();
+}
+
+Timestamp WeatherRecord::getTimestamp() const{
+    return timestamp;
 }
 
 float WeatherRecord::getWindSpeed() const{
@@ -26,11 +33,11 @@ float WeatherRecord::getSolarRadiation() const{
 }
 
 void WeatherRecord::setDate(const Date & d){
-    date = d;
+    timestamp = Timestamp(d, timestamp.toTime());
 }
 
 void WeatherRecord::setTime(const Time & t){
-    time = t;
+    timestamp = Timestamp(timestamp.toDate(), t);
 }
 
 void WeatherRecord::SetWindSpeed(float speed){
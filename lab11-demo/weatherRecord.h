@@ -3,6 +3,7 @@
 
 #include "date.h"
 #include "time.h"
+#include "timestamp.h"
 
 /**
  * @file weatherRecord.h
@@ -33,6 +34,15 @@ public:
      */
     WeatherRecord(const Date & d, const Time & t, float windSpeed, float temp, float solarRadiation);
 
+    /**
+     * @brief Constructor from an already packed date and time
+     * @param when Date and time of measurement
+     * @param windSpeed Wind speed in m/s
+     * @param temp Temperature in degrees Celsius
+     * @param solarRadiation Solar radiation in W/m
+     */
+    WeatherRecord(Timestamp when, float windSpeed, float temp, float solarRadiation);
+
     /**
      * @brief Gets the date of measurement
      * @return Date object representing when measurement was taken
@@ -45,6 +55,12 @@ public:
      */
     Time getTime() const;
 
+    /**
+     * @brief Gets the date and time of measurement without building a Date or Time
+     * @return Packed date and time
+     */
+    Timestamp getTimestamp() const;
+
     /**
      * @brief Gets the wind speed measurement
      * @return Wind speed in meters per second
@@ -94,8 +110,7 @@ public:
     void setSolarRadiation(float radiation);
 
 private:
-    Date date;              // Date of measurement
-    Time time;              // Time of measurement
+    Timestamp timestamp;    // Date and time of measurement, 8 bytes instead of six ints
     float windSpeed;        // Wind speedin m/s
     float temperature;      // Temp in degrees celsius
     float solarRadiation;   // Solar radiation in W/m2
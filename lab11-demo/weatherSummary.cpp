@@ -0,0 +1,215 @@
+/**
+ * @file weatherSummary.cpp
+ * @brief Implementation of the streaming per-month weather statistics
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ */
+
+#include "weatherSummary.h"
+#include "statistics.h"
+#include <cmath>
+#include <utility>
+
+namespace {
+    int monthKey(int month, int year) {
+        return year * 12 + month - 1;
+    }
+}
+
+WeatherSummary::WeatherSummary() : rowCount(0), currentKey(0), current(nullptr) {}
+
+int WeatherSummary::size() const {
+    return rowCount;
+}
+
+void WeatherSummary::reserve(int newCapacity) {
+    (void)newCapacity;
+}
+
+void WeatherSummary::clear() {
+    months.clear();
+    monthKeys.clear();
+    availableYears.destroyTree();
+    rowCount = 0;
+    current = nullptr;
+}
+
+void WeatherSummary::emplace_back(const Date & date, const Time & time, float windSpeed, float temperature,
+                                  float solarRadiation) {
+    add(Timestamp(date, time), windSpeed, temperature, solarRadiation);
+}
+
+void WeatherSummary::add(Timestamp when, float windSpeed, float temperature, float solarRadiation) {
+    // Readings arrive grouped by month, so the Map is only searched when the month changes.
+    // Any int can be a key, so "no month yet" is current == nullptr, not a key value
+    int key = monthKey(when.getMonth(), when.getYear());
+    if (current == nullptr || key != currentKey) {
+        current = &monthFor(key);
+        currentKey = key;
+    }
+
+    current->count++;
+    current->moments.add(windSpeed, temperature, solarRadiation);
+    current->windBins[binIndex(windSpeed, 0, windBinCount)]++;
+    current->tempBins[binIndex(temperature, tempBinOffset, tempBinCount)]++;
+    rowCount++;
+}
+
+void WeatherSummary::merge(const WeatherSummary & other) {
+    for (int m = 0; m < other.monthKeys.size(); m++) {
+        int key = other.monthKeys[m];
+        const MonthSummary* source = other.months.find(key);
+        MonthSummary& target = monthFor(key);
+
+        target.count += source->count;
+        target.moments.merge(source->moments);
+        for (int b = 0; b < windBinCount; b++) {
+            target.windBins[b] += source->windBins[b];
+        }
+        for (int b = 0; b < tempBinCount; b++) {
+            target.tempBins[b] += source->tempBins[b];
+        }
+    }
+    rowCount += other.rowCount;
+
+    // a new month may have moved the values current points at
+    current = nullptr;
+}
+
+bool WeatherSummary::CalculateWindSpeedStats(int month, int year, float& meanSpeed, float& stdev, float& mad) const {
+    const MonthSummary* summary = findMonth(month, year);
+    if (summary == nullptr) {
+        return false;
+    }
+
+    statistics::DescriptiveStats stats;
+    describeWind(*summary, stats);
+    meanSpeed = stats.mean;
+    stdev = stats.stdev;
+    mad = stats.mad;
+    return true;
+}
+
+bool WeatherSummary::calculateTemperatureStats(int month, int year, float& meanTemp, float& stdev, float& mad) const {
+    const MonthSummary* summary = findMonth(month, year);
+    if (summary == nullptr) {
+        return false;
+    }
+
+    statistics::DescriptiveStats stats;
+    describeTemperature(*summary, stats);
+    meanTemp = stats.mean;
+    stdev = stats.stdev;
+    mad = stats.mad;
+    return true;
+}
+
+bool WeatherSummary::calculateSolarRadiation(int month, int year, float& totalRadiation) const {
+    const MonthSummary* summary = findMonth(month, year);
+    if (summary == nullptr) {
+        return false;
+    }
+
+    totalRadiation = static_cast<float>(summary->moments.solar.sum);
+    return true;
+}
+
+bool WeatherSummary::calculatesPCC(int month, int year, WeatherParameter parameter1,
+                                   WeatherParameter parameter2, float& correlation) const {
+    const MonthSummary* summary = findMonth(month, year);
+    if (summary == nullptr || summary->count < 2) {
+        return false; // Need at least 2 points for correlation
+    }
+
+    correlation = statistics::calculatesPCC(summary->moments.select(parameter1), summary->moments.select(parameter2),
+                                            summary->moments.sumProducts(parameter1, parameter2));
+    return true;
+}
+
+bool WeatherSummary::hasDataForMonth(int month, int year) const {
+    return findMonth(month, year) != nullptr;
+}
+
+void WeatherSummary::calculateYearStats(int year, Vector<MonthStats>& stats) const {
+    stats.clear();
+    for (int month = 1; month <= 12; month++) {
+        const MonthSummary* summary = findMonth(month, year);
+        if (summary != nullptr) {
+            MonthStats monthStats;
+            monthStats.year = year;
+            monthStats.month = month;
+            describeWind(*summary, monthStats.wind);
+            describeTemperature(*summary, monthStats.temp);
+            monthStats.solarTotal = static_cast<float>(summary->moments.solar.sum);
+            stats.push_back(monthStats);
+        }
+    }
+}
+
+void WeatherSummary::getAvailableYears(Vector<int>& years) {
+    Vector<int> foundYears;
+    availableYears.inOrderTraversal([&foundYears](int& year) {
+        foundYears.push_back(year);
+    });
+    years = std::move(foundYears);
+}
+
+WeatherSummary::MonthSummary& WeatherSummary::monthFor(int key) {
+    MonthSummary* summary = months.find(key);
+    if (summary == nullptr) {
+        // First reading of this month: remember its key and add the year to
+        // the BST (BST handles duplicates by not inserting)
+        monthKeys.push_back(key);
+        availableYears.insertElement(key / 12);
+        summary = &months[key];
+    }
+    return *summary;
+}
+
+const WeatherSummary::MonthSummary* WeatherSummary::findMonth(int month, int year) const {
+    return months.find(monthKey(month, year));
+}
+
+void WeatherSummary::describeWind(const MonthSummary& summary, statistics::DescriptiveStats& stats) {
+    // bin centres in km/h, the same floats the analyzer gets from converting each reading
+    float centres[windBinCount];
+    for (int b = 0; b < windBinCount; b++) {
+        centres[b] = MonthMoments::convertMpsToKmh(binValue(b, 0));
+    }
+
+    double mean = summary.moments.wind.mean();
+    stats.count = summary.count;
+    stats.mean = static_cast<float>(mean);
+    stats.stdev = static_cast<float>(summary.moments.wind.standardDeviation());
+    stats.mad = statistics::calculateWeightedMAD(centres, summary.windBins, windBinCount, mean);
+}
+
+void WeatherSummary::describeTemperature(const MonthSummary& summary, statistics::DescriptiveStats& stats) {
+    float centres[tempBinCount];
+    for (int b = 0; b < tempBinCount; b++) {
+        centres[b] = binValue(b, tempBinOffset);
+    }
+
+    double mean = summary.moments.temp.mean();
+    stats.count = summary.count;
+    stats.mean = static_cast<float>(mean);
+    stats.stdev = static_cast<float>(summary.moments.temp.standardDeviation());
+    stats.mad = statistics::calculateWeightedMAD(centres, summary.tempBins, tempBinCount, mean);
+}
+
+int WeatherSummary::binIndex(float value, int offset, int count) {
+    long index = std::lround(static_cast<double>(value) * 10.0) + offset;
+    if (index < 0) {
+        return 0;
+    }
+    if (index >= count) {
+        return count - 1;
+    }
+    return static_cast<int>(index);
+}
+
+float WeatherSummary::binValue(int index, int offset) {
+    // a one decimal CSV value is parsed as digits / 10 in double, so this is
+    // exactly the float a reading in this bin was loaded as
+    return static_cast<float>((index - offset) / 10.0);
+}
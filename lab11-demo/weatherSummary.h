@@ -0,0 +1,223 @@
+#ifndef WEATHER_SUMMARY_H
+#define WEATHER_SUMMARY_H
+
+#include "vector.h"
+#include "map.h"
+#include "bst.h"
+#include "monthMoments.h"
+#include "timestamp.h"
+#include <string>
+
+/**
+ * @file weatherSummary.h
+ * @brief Per-month running statistics of weather readings that are not kept
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ */
+
+/**
+ * @class WeatherSummary
+ * @brief Streaming alternative to WeatherTable plus analyzeWeather
+ *
+ * loadWeatherData can fill a WeatherSummary the same way it fills a table:
+ * every parsed row goes to emplace_back, which adds it to the accumulators of
+ * its month and then forgets it. Memory is O(months) whatever the number of
+ * rows, and the queries have the same signatures and results as analyzeWeather:
+ *
+ * - mean, standard deviation, solar total and sPCC come from MonthMoments,
+ *   the same sums the analyzer keeps;
+ * - MAD needs the distance of every value from the final mean, so each month
+ *   also counts its wind and temperature readings in 0.1 m/s and 0.1 degree C
+ *   bins. MetData values have one decimal, so every reading sits on a bin
+ *   centre and MAD is exact; readings with more decimals are off by at most
+ *   half a bin (0.05 m/s or 0.05 degrees C), and readings outside the bin
+ *   range (0 to 60 m/s, -50 to 60 degrees C) are counted in the end bins.
+ */
+class WeatherSummary {
+public:
+    /**
+     * @brief Creates an empty summary
+     */
+    WeatherSummary();
+
+    // current points into months, so a copy would point into the original
+    WeatherSummary(const WeatherSummary&) = delete;
+    WeatherSummary& operator=(const WeatherSummary&) = delete;
+
+    /**
+     * @brief Number of readings added
+     * @return Rows added since construction or clear
+     */
+    int size() const;
+
+    /**
+     * @brief Does nothing, the summary does not grow with the rows; lets the loader treat it like a table
+     * @param newCapacity Ignored
+     */
+    void reserve(int newCapacity);
+
+    /**
+     * @brief Removes every month
+     */
+    void clear();
+
+    /**
+     * @brief Adds one reading, same arguments as the WeatherRecord constructor
+     * @param date Date of measurement
+     * @param time Time of measurement
+     * @param windSpeed Wind speed in m/s
+     * @param temperature Temperature in degrees Celsius
+     * @param solarRadiation Solar radiation in W/m2
+     */
+    void emplace_back(const Date & date, const Time & time, float windSpeed, float temperature,
+                      float solarRadiation);
+
+    /**
+     * @brief Adds one reading with an already packed date and time
+     * @param when Date and time of measurement
+     * @param windSpeed Wind speed in m/s
+     * @param temperature Temperature in degrees Celsius
+     * @param solarRadiation Solar radiation in W/m2
+     */
+    void add(Timestamp when, float windSpeed, float temperature, float solarRadiation);
+
+    /**
+     * @brief Adds every reading of another summary, e.g. one built from another file
+     * @param other Summary to merge in
+     */
+    void merge(const WeatherSummary & other);
+
+    /**
+     * @brief Wind speed statistics for a month, as analyzeWeather::CalculateWindSpeedStats
+     * @param month Month to analyze (1-12)
+     * @param year Year to analyze
+     * @param meanSpeed Output parameter for mean wind speed in km/h
+     * @param stdev Output parameter for standard deviation in km/h
+     * @param mad Output parameter for mean absolute deviation in km/h
+     * @return true if data found and calculated, false if no data available
+     */
+    bool CalculateWindSpeedStats(int month, int year, float& meanSpeed, float& stdev, float& mad) const;
+
+    /**
+     * @brief Temperature statistics for a month, as analyzeWeather::calculateTemperatureStats
+     * @param month Month to analyze (1-12)
+     * @param year Year to analyze
+     * @param meanTemp Output parameter for mean temperature in degrees C
+     * @param stdev Output parameter for standard deviation in degrees C
+     * @param mad Output parameter for mean absolute deviation in degrees C
+     * @return true if data found and calculated, false if no data available
+     */
+    bool calculateTemperatureStats(int month, int year, float& meanTemp, float& stdev, float& mad) const;
+
+    /**
+     * @brief Total solar radiation for a month, as analyzeWeather::calculateSolarRadiation
+     * @param month Month to analyze (1-12)
+     * @param year Year to analyze
+     * @param totalRadiation Output parameter for total radiation in kWh/m2
+     * @return true if data found and calculated, false if no data available
+     */
+    bool calculateSolarRadiation(int month, int year, float& totalRadiation) const;
+
+    /**
+     * @brief sPCC between two parameters for a month, as analyzeWeather::calculatesPCC
+     * @param month Month to analyze (1-12)
+     * @param year Year to analyze
+     * @param parameter1 First parameter
+     * @param parameter2 Second parameter
+     * @param correlation Output parameter for correlation coefficient (-1 to 1)
+     * @return true if data found and calculated, false if no data available
+     */
+    bool calculatesPCC(int month, int year, WeatherParameter parameter1,
+                       WeatherParameter parameter2, float& correlation) const;
+
+    /**
+     * @brief Checks if data exists for a specific month and year
+     * @param month Month to check (1-12)
+     * @param year Year to check
+     * @return true if at least one reading was added for the month
+     */
+    bool hasDataForMonth(int month, int year) const;
+
+    /**
+     * @brief Every export statistic of each month of a year, as analyzeWeather::calculateYearStats
+     * @param year Year to analyze
+     * @param stats Output, one entry per month with data, in month order (empty if none)
+     */
+    void calculateYearStats(int year, Vector<MonthStats>& stats) const;
+
+    /**
+     * @brief Gets all years with readings
+     * @param years Vector to store the years, in ascending order
+     */
+    void getAvailableYears(Vector<int>& years);
+
+private:
+    static const int windBinCount = 601;    // 0.0 to 60.0 m/s in 0.1 m/s steps
+    static const int tempBinCount = 1101;   // -50.0 to 60.0 degrees C in 0.1 degrees C steps
+    static const int tempBinOffset = 500;   // Bin of 0.0 degrees C
+
+    /**
+     * @brief Accumulators of one month
+     */
+    struct MonthSummary {
+        int count = 0;                      // Readings in the month
+        MonthMoments moments;               // Sums for mean, stdev, total and sPCC
+        int windBins[windBinCount] = {};    // Readings per 0.1 m/s wind bin, for MAD
+        int tempBins[tempBinCount] = {};    // Readings per 0.1 degrees C temperature bin, for MAD
+    };
+
+    Map<int, MonthSummary> months;              // Month key (year * 12 + month - 1) to its accumulators
+    Vector<int> monthKeys;                      // Every key of months once, in order of first reading
+    BalancedSearchTree<int> availableYears;     // Years with readings
+    int rowCount;                               // Readings added
+    int currentKey;                             // Key of the month of the last reading, if current is set
+    MonthSummary* current;                      // Its accumulators, nullptr before the first reading and after merge
+
+    /**
+     * @brief Finds the accumulators of a month, adding the month if it is new
+     * @param key Month key
+     * @return Accumulators of the month, valid until the next new month
+     */
+    MonthSummary& monthFor(int key);
+
+    /**
+     * @brief Finds the accumulators of a month
+     * @param month Month (1-12)
+     * @param year Year
+     * @return Accumulators of the month, nullptr if it has no readings
+     */
+    const MonthSummary* findMonth(int month, int year) const;
+
+    /**
+     * @brief Wind speed statistics of a month from its sums and histogram
+     * @param summary Accumulators of the month
+     * @param stats Output in km/h
+     */
+    static void describeWind(const MonthSummary& summary, statistics::DescriptiveStats& stats);
+
+    /**
+     * @brief Temperature statistics of a month from its sums and histogram
+     * @param summary Accumulators of the month
+     * @param stats Output in degrees C
+     */
+    static void describeTemperature(const MonthSummary& summary, statistics::DescriptiveStats& stats);
+
+    /**
+     * @brief Bin of a value on a 0.1 grid, clamped to the bin range
+     * @param value Reading
+     * @param offset Bin of 0.0
+     * @param count Number of bins
+     * @return Bin index
+     */
+    static int binIndex(float value, int offset, int count);
+
+    /**
+     * @brief Value at the centre of a bin, parsed the same way as the CSV text
+     * @param index Bin index
+     * @param offset Bin of 0.0
+     * @return Centre value
+     */
+    static float binValue(int index, int offset);
+};
+
+#endif // WEATHER_SUMMARY_H
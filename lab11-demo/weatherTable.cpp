@@ -0,0 +1,47 @@
+/**
+ * @file weatherTable.cpp
+ * @brief Implementation of the columnar weather record storage
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ */
+
+#include "weatherTable.h"
+
+void WeatherTable::reserve(int newCapacity) {
+    timestampColumn.reserve(newCapacity);
+    windColumn.reserve(newCapacity);
+    temperatureColumn.reserve(newCapacity);
+    solarColumn.reserve(newCapacity);
+}
+
+void WeatherTable::clear() {
+    timestampColumn.clear();
+    windColumn.clear();
+    temperatureColumn.clear();
+    solarColumn.clear();
+}
+
+void WeatherTable::emplace_back(const Date & date, const Time & time, float windSpeed, float temperature,
+                                float solarRadiation) {
+    timestampColumn.push_back(Timestamp(date, time).getPacked());
+    windColumn.push_back(windSpeed);
+    temperatureColumn.push_back(temperature);
+    solarColumn.push_back(solarRadiation);
+}
+
+void WeatherTable::append(const std::uint64_t * timestamps, const float * windSpeeds, const float * temperatures,
+                          const float * solarRadiation, int count) {
+    // one memcpy per column
+    timestampColumn.append(timestamps, count);
+    windColumn.append(windSpeeds, count);
+    temperatureColumn.append(temperatures, count);
+    solarColumn.append(solarRadiation, count);
+}
+
+void WeatherTable::append(const WeatherTable & other) {
+    append(other.timestamps(), other.windSpeeds(), other.temperatures(), other.solarRadiation(), other.size());
+}
+
+WeatherRecord WeatherTable::getRecord(int index) const {
+    return WeatherRecord(getTimestamp(index), windColumn[index], temperatureColumn[index], solarColumn[index]);
+}
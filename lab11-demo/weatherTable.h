@@ -0,0 +1,170 @@
+#ifndef WEATHER_TABLE_H
+#define WEATHER_TABLE_H
+
+#include "vector.h"
+#include "weatherRecord.h"
+#include "timestamp.h"
+#include <cstdint>
+
+/**
+ * @file weatherTable.h
+ * @brief Columnar storage of weather records
+ * @author Dhruv Goswami
+ * @date 16/10/2026
+ *
+ * A WeatherRecord is 24 bytes (an 8 byte Timestamp and three floats, padded to
+ * 8 byte alignment), but a statistic reads one or two of its floats, so a scan
+ * over Vector<WeatherRecord> uses a small part of every cache line it loads.
+ * WeatherTable keeps each field in its own contiguous array instead, so a scan
+ * over one field reads only that field and can be handed straight to the span
+ * versions of the statistics functions.
+ */
+
+/**
+ * @class WeatherTable
+ * @brief Weather records stored as one array per field (structure of arrays)
+ *
+ * Row i is made of timestamps()[i], windSpeeds()[i], temperatures()[i] and
+ * solarRadiation()[i]. Timestamps are stored as Timestamp::getPacked values,
+ * so they compare in date and time order and the year and month can be read
+ * without building a Date.
+ */
+class WeatherTable {
+public:
+    /**
+     * @brief Number of rows
+     * @return Number of records in the table
+     */
+    int size() const;
+
+    /**
+     * @brief Makes room for rows without changing the size
+     * @param newCapacity Number of rows to make room for
+     */
+    void reserve(int newCapacity);
+
+    /**
+     * @brief Removes every row
+     */
+    void clear();
+
+    /**
+     * @brief Appends one row, same arguments as the WeatherRecord constructor
+     * @param date Date of measurement
+     * @param time Time of measurement
+     * @param windSpeed Wind speed in m/s
+     * @param temperature Temperature in degrees Celsius
+     * @param solarRadiation Solar radiation in W/m2
+     */
+    void emplace_back(const Date & date, const Time & time, float windSpeed, float temperature,
+                      float solarRadiation);
+
+    /**
+     * @brief Appends rows that are already split into columns
+     * @param timestamps Packed timestamps
+     * @param windSpeeds Wind speeds in m/s
+     * @param temperatures Temperatures in degrees Celsius
+     * @param solarRadiation Solar radiation in W/m2
+     * @param count Number of rows in each array
+     */
+    void append(const std::uint64_t * timestamps, const float * windSpeeds, const float * temperatures,
+                const float * solarRadiation, int count);
+
+    /**
+     * @brief Appends every row of another table
+     * @param other Table to copy the rows from
+     */
+    void append(const WeatherTable & other);
+
+    /**
+     * @brief Builds the record of one row
+     * @param index Row number
+     * @return The row as a WeatherRecord
+     */
+    WeatherRecord getRecord(int index) const;
+
+    /**
+     * @brief Gets the date and time of one row
+     * @param index Row number
+     * @return Packed date and time
+     */
+    Timestamp getTimestamp(int index) const;
+
+    /**
+     * @brief Gets the year of one row from its packed timestamp
+     * @param index Row number
+     * @return Year
+     */
+    int getYear(int index) const;
+
+    /**
+     * @brief Gets the month of one row from its packed timestamp
+     * @param index Row number
+     * @return Month (1-12)
+     */
+    int getMonth(int index) const;
+
+    /**
+     * @brief Column of packed timestamps
+     * @return Pointer to size() timestamps
+     */
+    const std::uint64_t * timestamps() const;
+
+    /**
+     * @brief Column of wind speeds
+     * @return Pointer to size() wind speeds in m/s
+     */
+    const float * windSpeeds() const;
+
+    /**
+     * @brief Column of temperatures
+     * @return Pointer to size() temperatures in degrees Celsius
+     */
+    const float * temperatures() const;
+
+    /**
+     * @brief Column of solar radiation
+     * @return Pointer to size() solar radiation values in W/m2
+     */
+    const float * solarRadiation() const;
+
+private:
+    Vector<std::uint64_t> timestampColumn;  // Timestamp::getPacked of every row
+    Vector<float> windColumn;               // Wind speed (m/s)
+    Vector<float> temperatureColumn;        // Temperature (degrees C)
+    Vector<float> solarColumn;              // Solar radiation (W/m2)
+};
+
+inline int WeatherTable::size() const {
+    return timestampColumn.size();
+}
+
+inline Timestamp WeatherTable::getTimestamp(int index) const {
+    return Timestamp(timestampColumn[index]);
+}
+
+inline int WeatherTable::getYear(int index) const {
+    return getTimestamp(index).getYear();
+}
+
+inline int WeatherTable::getMonth(int index) const {
+    return getTimestamp(index).getMonth();
+}
+
+inline const std::uint64_t * WeatherTable::timestamps() const {
+    return timestampColumn.begin();
+}
+
+inline const float * WeatherTable::windSpeeds() const {
+    return windColumn.begin();
+}
+
+inline const float * WeatherTable::temperatures() const {
+    return temperatureColumn.begin();
+}
+
+inline const float * WeatherTable::solarRadiation() const {
+    return solarColumn.begin();
+}
+
+#endif // WEATHER_TABLE_H